@@ -20,11 +20,11 @@
 //   - `EHUDType` is used by the Player Controller to manage which UI widget is currently active.
 //
 // Summary of Enum Categories:
-// - **System & Settings**: `ELogLevel`, `EGameLevel`, `EHUDType`, `ELanguage`, `EWindowModeOur`, etc. These define application-level states and options.
-// - **Gameplay State**: `EGPStatus`, `ETeam`. These define the high-level state of the match and players.
-// - **Gameplay Types**: `ECatRace`, `EHumanProfession`, `EEnvActor`, `EItem`, `EAbility`, `EHat`. These define the specific "types" of various game entities.
+// - **System & Settings**: `ELogLevel`, `ELogFileFormat`, `EGameLevel`, `EHUDType`, `ELanguage`, `EWindowModeOur`, etc. These define application-level states and options.
+// - **Gameplay State**: `EGPStatus`, `ETeam`, `EEntityList`, `ELobbyEvent`, `ECharacterSignificance`. These define the high-level state of the match and players.
+// - **Gameplay Types**: `ECatRace`, `EHumanProfession`, `EEnvActor`, `EItem`, `EAbility`, `EHat`. These define the specific "types" of various game entities. `EMPClassCategory` tells the class registry which of these a factory code refers to.
 // - **Animation States**: `EMoveState`, `EAirState`, `ECatPosture`, `EHumanPosture`, etc. These are used exclusively by the animation system to define a character's current pose and action.
-// - **AI States**: `EAICatState`, `EAIHumanState`. These are used in Behavior Trees and Blackboards to control AI decision-making.
+// - **AI States**: `EAICatState`, `EAIHumanState`, `EAIBudgetTier`. These are used in Behavior Trees and Blackboards to control AI decision-making.
 
 #include "CoreMinimal.h"
 #include "CommonEnum.generated.h"
@@ -40,12 +40,48 @@ enum class ELogLevel : uint8 {
 	Verbose = 5
 };
 
+UENUM(BlueprintType, Blueprintable)
+enum class ELogFileFormat : uint8 {
+	EJsonLines UMETA(DisplayName = "JSON Lines"),
+	EBinary UMETA(DisplayName = "Binary")
+};
+
 UENUM(BlueprintType, Blueprintable)
 enum class EGameLevel : uint8 {
 	EInit UMETA(DisplayName = "Init Level"),
 	EGameplay UMETA(DisplayName = "Gameplay Level")
 };
 
+UENUM(BlueprintType, Blueprintable)
+enum class EEntityList : uint8 {
+	EHuman,
+	ECat,
+	EItem,
+	EEnvActor
+};
+
+// what happened to one lobby roster entry, raised by AMPGS on the server and on every client
+UENUM(BlueprintType)
+enum class ELobbyEvent : uint8 {
+	EPlayerJoined,
+	EPlayerLeft,
+	ESwitchedTeam,
+	EReadyChanged,
+	EBotAdded,
+	EBotRemoved,
+	// name or index changed, e.g. the bots after a removed one are renumbered
+	EUpdated
+};
+
+// how much a character matters to the viewers of this machine, ranked by UMPCharacterSignificance
+UENUM(BlueprintType)
+enum class ECharacterSignificance : uint8 {
+	High,
+	Medium,
+	Low,
+	Minimal
+};
+
 UENUM(BlueprintType, Blueprintable)
 enum class EGPStatus : uint8 {
 	ELobby,
@@ -170,6 +206,18 @@ enum class EAbility : uint8 {
 	EAbilityMax
 };
 
+// which enum a factory's actorCode is read as when resolving through UMPClassRegistry
+UENUM(BlueprintType, Blueprintable)
+enum class EMPClassCategory : uint8 {
+	ECat,
+	EHuman,
+	EItem,
+	EEnvActor,
+	EAbility,
+	EAIController,
+	EMax
+};
+
 UENUM(BlueprintType, Blueprintable)
 enum class EHat : uint8 {
 	ENone,
@@ -295,6 +343,15 @@ enum class EAIHumanState : uint8
     Stunned         UMETA(DisplayName="Stunned")
 };
 
+// how often a bot is updated, set by AMPAISystemManager from its distance to the nearest player
+UENUM(BlueprintType)
+enum class EAIBudgetTier : uint8
+{
+    Near            UMETA(DisplayName="Near"),
+    Far             UMETA(DisplayName="Far"),
+    Dormant         UMETA(DisplayName="Dormant")
+};
+
 // enum
 UENUM(BlueprintType)
 enum class EMPItem : uint8
@@ -1 +1,71 @@
-#include "CommonStruct.h"
\ No newline at end of file
+#include "CommonStruct.h"
+
+namespace
+{
+	// bit widths of the packed anim state fields, widen them when an enum outgrows its field
+	constexpr uint32 CatPostureBits = 2;
+	constexpr uint32 HumanPostureBits = 1;
+	constexpr uint32 CatContextBits = 4;
+	constexpr uint32 HumanContextBits = 3;
+	constexpr uint32 InteractionBits = 2;
+
+	static_assert((uint32)ECatPosture::Lying < (1u << CatPostureBits), "ECatPosture no longer fits its packed field");
+	static_assert((uint32)EHumanPosture::Crouching < (1u << HumanPostureBits), "EHumanPosture no longer fits its packed field");
+	static_assert((uint32)ECatContext::LyingSleepSpot < (1u << CatContextBits), "ECatContext no longer fits its packed field");
+	static_assert((uint32)EHumanContext::TurnOnPower < (1u << HumanContextBits), "EHumanContext no longer fits its packed field");
+	static_assert((uint32)ECatInteractionState::BeingRubbed < (1u << InteractionBits), "ECatInteractionState no longer fits its packed field");
+	static_assert((uint32)EHumanInteractionState::BeingRubbed < (1u << InteractionBits), "EHumanInteractionState no longer fits its packed field");
+
+	// layout, low bits first: running(1) | interaction | context | posture
+	template<typename TPosture, typename TContext, typename TInteraction>
+	void SerializePackedAnimState(FArchive& Ar, TPosture& posture, EMoveState& move, TContext& context, TInteraction& interaction,
+		uint32 postureBits, uint32 contextBits)
+	{
+		const uint32 totalBits = 1 + InteractionBits + contextBits + postureBits;
+		uint32 packed = 0;
+
+		if (Ar.IsSaving())
+		{
+			uint32 shift = 0;
+			packed |= (move == EMoveState::Run ? 1u : 0u) << shift;  shift += 1;
+			packed |= (uint32)interaction << shift;                   shift += InteractionBits;
+			packed |= (uint32)context << shift;                       shift += contextBits;
+			packed |= (uint32)posture << shift;
+		}
+
+		Ar.SerializeBits(&packed, totalBits);
+
+		if (Ar.IsLoading())
+		{
+			uint32 shift = 0;
+			const bool isRunning = (packed >> shift) & 1u;                                  shift += 1;
+			interaction = (TInteraction)((packed >> shift) & ((1u << InteractionBits) - 1)); shift += InteractionBits;
+			context = (TContext)((packed >> shift) & ((1u << contextBits) - 1));             shift += contextBits;
+			posture = (TPosture)((packed >> shift) & ((1u << postureBits) - 1));
+
+			// idle / walk stay whatever the local simulation says, only running is authoritative
+			if (isRunning)
+			{
+				move = EMoveState::Run;
+			}
+			else if (move == EMoveState::Run)
+			{
+				move = EMoveState::Walk;
+			}
+		}
+	}
+}
+
+bool FCatAnimState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	SerializePackedAnimState(Ar, curPosture, curMove, curContext, curInteraction, CatPostureBits, CatContextBits);
+	bOutSuccess = true;
+	return true;
+}
+
+bool FHumanAnimState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	SerializePackedAnimState(Ar, curPosture, curMove, curContext, curInteraction, HumanPostureBits, HumanContextBits);
+	bOutSuccess = true;
+	return true;
+}
@@ -14,9 +14,10 @@
 // - For example:
 //   - `FLogConfig` is used by `UManagerLog` to configure its behavior.
 //   - `FSessionInfo` is used by the `UMPGI` and `UHUDSearchSession` widgets to store and display data about found multiplayer games.
-//   - `FCatAnimState` and `FHumanAnimState` are critical structs used by the `AMPCharacterCat` and `AMPCharacterHuman` classes, respectively. These structs are replicated and contain all the information their Animation Blueprints need to drive the animation state machines.
+//   - `FCatAnimState` and `FHumanAnimState` are critical structs used by the `AMPCharacterCat` and `AMPCharacterHuman` classes, respectively. These structs are replicated and contain all the information their Animation Blueprints need to drive the animation state machines. Their `NetSerialize` packs posture, context, interaction and a running flag into one small bitfield (9 bits for a cat, 7 for a human); the air state and idle/walk are simulated by each client from replicated movement.
 //   - `FLocalizedText` is likely the base struct for the rows in the localization DataTable.
 //   - `FCreditEntryData` is used by the `UHUDCredit` widget to populate its list of credits.
+//   - `FMatchPhaseClock` is replicated by `AMPGS` so every client can count down the current match phase on its own.
 
 #include "CoreMinimal.h"
 #include "CommonEnum.h"
@@ -43,12 +44,29 @@ struct FLogConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Logging")
 	float screenLogDuration = 5.0f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Logging")
+	ELogFileFormat fileLogFormat = ELogFileFormat::EJsonLines;
+
+	// lines buffered between the game thread and the writer thread, further lines are dropped and counted
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Logging")
+	int32 fileLogBufferLines = 4096;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Logging")
+	int32 fileLogMaxSizeKB = 10240;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Logging")
+	int32 fileLogMaxRotatedFiles = 5;
+
 	FLogConfig()
 	{
 		logLevel = ELogLevel::Warning;
 		enableScreenLogging = false;
 		enableFileLogging = false;
 		screenLogDuration = 5.0f;
+		fileLogFormat = ELogFileFormat::EJsonLines;
+		fileLogBufferLines = 4096;
+		fileLogMaxSizeKB = 10240;
+		fileLogMaxRotatedFiles = 5;
 	}
 };
 
@@ -98,6 +116,29 @@ struct FCatAnimState
     
     UPROPERTY(BlueprintReadOnly, Category = "Animation State")
     ECatInteractionState curInteraction = ECatInteractionState::None;
+
+    // only what the server owns goes over the wire: posture, context, interaction and whether it runs.
+    // curAir and idle/walk are derived from replicated movement on every machine, so they never trigger a send
+    bool operator==(const FCatAnimState& other) const
+    {
+        return curPosture == other.curPosture
+            && curContext == other.curContext
+            && curInteraction == other.curInteraction
+            && (curMove == EMoveState::Run) == (other.curMove == EMoveState::Run);
+    }
+    bool operator!=(const FCatAnimState& other) const { return !(*this == other); }
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCatAnimState> : public TStructOpsTypeTraitsBase2<FCatAnimState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithIdenticalViaEquality = true,
+    };
 };
 
 USTRUCT(BlueprintType)
@@ -119,6 +160,28 @@ struct FHumanAnimState
     
     UPROPERTY(BlueprintReadOnly, Category = "Animation State")
     EHumanInteractionState curInteraction = EHumanInteractionState::None;
+
+    // same split as FCatAnimState
+    bool operator==(const FHumanAnimState& other) const
+    {
+        return curPosture == other.curPosture
+            && curContext == other.curContext
+            && curInteraction == other.curInteraction
+            && (curMove == EMoveState::Run) == (other.curMove == EMoveState::Run);
+    }
+    bool operator!=(const FHumanAnimState& other) const { return !(*this == other); }
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FHumanAnimState> : public TStructOpsTypeTraitsBase2<FHumanAnimState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithIdenticalViaEquality = true,
+    };
 };
 
 // Localization Text Structure
@@ -203,3 +266,20 @@ struct FCreditEntryData
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Credit")
     FString Source;
 };
+
+// Match phase deadline, replicated once per phase change.
+// Clients count down locally against the synced server clock instead of receiving every second.
+USTRUCT(BlueprintType)
+struct FMatchPhaseClock
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Match Clock")
+	EGPStatus phase = EGPStatus::ELobby;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Match Clock")
+	float phaseEndServerTime = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Match Clock")
+	bool isRunning = false;
+};
@@ -1,37 +1,10 @@
 #include "FactoryAIController.h"
 #include "../../CommonEnum.h"
+#include "../../MPActor/AI/MPAIController.h"
 
 UFactoryAIController::UFactoryAIController()
 {
-
-}
-
-AActor* UFactoryAIController::SpawnMPActor(int actorCode,
-    FVector actorLocation, FRotator actorRotation)
-{
-    if (gameWorld)
-    {
-        switch (actorCode)
-        {
-            case 0 :
-            {
-                if (catAIControllerClass)
-                {
-                    spawnedActor = gameWorld->SpawnActor<AActor>(catAIControllerClass, actorLocation, actorRotation);
-                }
-                break;
-            }
-            case 3:
-            {
-                if (humanAIControllerClass)
-                {
-                    spawnedActor = gameWorld->SpawnActor<AActor>(humanAIControllerClass, actorLocation, actorRotation);
-                }
-                break;
-            }
-        }
-    }
-    return spawnedActor;
+    registryCategory = EMPClassCategory::EAIController;
 }
 
 AMPAIController* UFactoryAIController::SpawnAIController(ETeam team)
@@ -41,29 +14,11 @@ AMPAIController* UFactoryAIController::SpawnAIController(ETeam team)
         return nullptr;
     }
     
-    AMPAIController* aiController = nullptr;
-    
-    switch (team)
+    TSubclassOf<AMPAIController> controllerClass = ResolveSpawnClass(static_cast<int>(team));
+    if (!controllerClass)
     {
-        case ETeam::ECat:
-        {
-            if (catAIControllerClass)
-            {
-                aiController = gameWorld->SpawnActor<AMPAIController>(catAIControllerClass);
-            }
-            break;
-        }
-        case ETeam::EHuman:
-        {
-            if (humanAIControllerClass)
-            {
-                aiController = gameWorld->SpawnActor<AMPAIController>(humanAIControllerClass);
-            }
-            break;
-        }
-        default:
-            break;
+        return nullptr;
     }
     
-    return aiController;
+    return gameWorld->SpawnActor<AMPAIController>(controllerClass);
 }
@@ -7,17 +7,17 @@
 //
 // How to utilize in Blueprint:
 // 1. Create a Blueprint class that inherits from `UFactoryAIController`.
-// 2. In this Blueprint, you MUST assign the `Cat AI Controller Class` and `Human AI Controller Class` properties. These should be set to your specific AI Controller Blueprints (e.g., `BP_CatAIController`, `BP_HumanAIController`).
+// 2. In the class registry data asset, register your specific AI Controller Blueprints (e.g., `BP_CatAIController`, `BP_HumanAIController`) in the `Ai Controller Classes` map under `ECat` and `EHuman`.
 // 3. In your game logic (e.g., in a Game Mode or a Character Spawner), create an instance of your `UFactoryAIController` Blueprint.
-// 4. Ensure the `gameWorld` is set by calling `SetGameWorld` (inherited from UMPFactory).
+// 4. Ensure the `gameWorld` and class registry are set by calling `SetGameWorld` and `SetClassRegistry` (inherited from UMPFactory).
 // 5. Call the `SpawnAIController` function, passing in the desired `ETeam`. This will spawn and return the correct AI Controller for that team.
 //
 // Necessary things to define:
-// - `catAIControllerClass`: In the Blueprint editor, you must set this to the AI Controller class that should be used for the Cat team.
-// - `humanAIControllerClass`: In the Blueprint editor, you must set this to the AI Controller class that should be used for the Human team.
+// - The class registry must have an AI Controller class for both `ETeam::ECat` and `ETeam::EHuman`.
 //
 // How it interacts with other classes:
-// - UMPFactory: It inherits the base spawning functionality. The `SpawnMPActor` override is less likely to be used directly in favor of the more specific `SpawnAIController`.
+// - UMPFactory: It inherits the base spawning functionality. `SpawnMPActor` reads `actorCode` as an `ETeam`, but the more specific `SpawnAIController` is preferred.
+// - UMPClassRegistry: Resolves `ETeam` values to the AI Controller classes.
 // - AMPAIController: This factory spawns instances of `AMPAIController` child classes.
 // - ETeam (Enum): The `SpawnAIController` function uses this enum to decide which AI Controller class to spawn.
 // - Game Mode / Spawning Logic: The Game Mode (like `AMPGMGameplay`) will likely use this factory when a new character is spawned into the world to assign it an appropriate AI Controller.
@@ -37,17 +37,7 @@ public:
 	UFactoryAIController();
 
 public :
-	virtual AActor* SpawnMPActor(int actorCode, FVector actorLoItemion, FRotator actorRotation) override;
-
 	// Spawn AI controller by team
 	UFUNCTION(BlueprintCallable, Category = "AI Controller Factory")
 	AMPAIController* SpawnAIController(ETeam team);
-
-// all tsubclassof
-protected :
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cat Factory Stats")
-		TSubclassOf<AMPAIController> catAIControllerClass;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cat Factory Stats")
-		TSubclassOf<AMPAIController> humanAIControllerClass;
 };
@@ -4,7 +4,7 @@
 
 UFactoryAbility::UFactoryAbility()
 {
-
+    registryCategory = EMPClassCategory::EAbility;
 }
 
 AActor* UFactoryAbility::SpawnMPActor(int actorCode,
@@ -12,9 +12,12 @@ AActor* UFactoryAbility::SpawnMPActor(int actorCode,
 {
     if (!gameWorld) { return nullptr; }
 
-    // For now we only have one ability class – could map code to subclasses later.
-    TSubclassOf<AActor> spawnClass = AMPAbility::StaticClass();
-    spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    // abilities not registered yet still spawn as the base class
+    TSubclassOf<AActor> spawnClass = ResolveSpawnClass(actorCode);
+    if (!spawnClass)
+    {
+        spawnClass = AMPAbility::StaticClass();
+    }
 
-    return gameWorld->SpawnActor<AActor>(spawnClass, actorLocation, actorRotation, spawnParams);
+    return SpawnPooledActor(spawnClass, actorLocation, actorRotation);
 }
@@ -8,16 +8,17 @@
 // How to utilize in Blueprint:
 // 1. Create a Blueprint class that inherits from `UFactoryAbility`.
 // 2. In your game logic (e.g., within a character or ability manager Blueprint), create an instance of your `UFactoryAbility` Blueprint.
-// 3. Before spawning, ensure the `gameWorld` is set by calling the `SetGameWorld` function, which is inherited from `UMPFactory`.
-// 4. Call the `SpawnMPActor` function with the appropriate `actorCode` for the ability you wish to create. This function will return the spawned ability actor.
+// 3. Before spawning, ensure the `gameWorld` and class registry are set by calling `SetGameWorld` and `SetClassRegistry`, which are inherited from `UMPFactory`.
+// 4. Call the `SpawnMPActor` function with the `EAbility` value of the ability you wish to create. This function will return the spawned ability actor.
 //
 // Necessary things to define:
-// - The implementation of `SpawnMPActor` in the corresponding C++ source file (`FactoryAbility.cpp`) must contain the logic to handle different `actorCode` values. Each code should map to a specific ability class to be spawned.
+// - The `Ability Classes` map of the class registry data asset maps each `EAbility` value to its ability class. Abilities without an entry fall back to the base `AMPAbility`.
 //
 // How it interacts with other classes:
 // - UMPFactory: It inherits from `UMPFactory` to get the basic actor spawning framework.
-// - AMPAbility: This factory is responsible for creating instances of `AMPAbility` or its child classes. The `SpawnMPActor` function will be configured to spawn different types of abilities based on the provided code.
+// - AMPAbility: This factory is responsible for creating instances of `AMPAbility` or its child classes, resolved through the class registry.
 // - Character Classes (e.g., AMPCharacterCat): Characters will likely use this factory to spawn their abilities during gameplay. For instance, when a player presses an ability key, the character would use the ability factory to create the corresponding ability actor in the world.
+// - Pooling: With `usePooling` enabled, abilities handed back through `AMPGMGameplay::ReleaseAbility` are reused instead of spawned again.
 
 #include "CoreMinimal.h"
 #include "MPFactory.h"
@@ -2,11 +2,5 @@
 
 UFactoryEnvironment::UFactoryEnvironment()
 {
-
-}
-
-AActor* UFactoryEnvironment::SpawnMPActor(int actorCode,
-    FVector actorLocation, FRotator actorRotation)
-{
-    return nullptr;
+    registryCategory = EMPClassCategory::EEnvActor;
 }
@@ -2,11 +2,5 @@
 
 UFactoryHuman::UFactoryHuman()
 {
-
-}
-
-AActor* UFactoryHuman::SpawnMPActor(int actorCode,
-    FVector actorLocation, FRotator actorRotation)
-{
-    return nullptr;
+    registryCategory = EMPClassCategory::EHuman;
 }
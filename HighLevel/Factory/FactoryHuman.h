@@ -7,17 +7,17 @@
 //
 // How to utilize in Blueprint:
 // 1. Create a Blueprint class that inherits from `UFactoryHuman`.
-// 2. In this Blueprint, you can add properties to define the specific `AMPCharacterHuman` subclasses to be spawned (e.g., different human player models). These would be added as `TSubclassOf<AMPCharacterHuman>` UPROPERTIES.
+// 2. Register the `AMPCharacterHuman` Blueprints to be spawned (e.g., different human player models) in the `Human Classes` map of the class registry data asset.
 // 3. In your Game Mode or other manager classes, create an instance of your `UFactoryHuman` Blueprint.
-// 4. Before spawning, call the `SetGameWorld` function (inherited from `UMPFactory`).
-// 5. Use the `SpawnMPActor` function with an `actorCode` to create a specific human character at the desired location and rotation.
+// 4. Before spawning, call the `SetGameWorld` and `SetClassRegistry` functions (inherited from `UMPFactory`).
+// 5. Use the `SpawnMPActor` function with an `EHumanProfession` value as `actorCode` to create a specific human character at the desired location and rotation.
 //
 // Necessary things to define:
-// - The C++ implementation of `SpawnMPActor` in `FactoryHuman.cpp` must be filled out with logic (like a switch statement) that maps `actorCode` values to the `TSubclassOf<AMPCharacterHuman>` properties you define in the Blueprint.
-// - In the `UFactoryHuman` Blueprint, you must assign the actual character Blueprints to the `TSubclassOf` properties you've exposed.
+// - The class registry must contain an entry for every `EHumanProfession` that can be spawned, including `EDiedHuman`.
 //
 // How it interacts with other classes:
-// - UMPFactory: It derives from the base factory to get common spawning functionality.
+// - UMPFactory: It derives from the base factory to get common spawning functionality, including the registry lookup.
+// - UMPClassRegistry: Resolves `EHumanProfession` values to the human classes to spawn.
 // - AMPCharacterHuman: The primary purpose of this factory is to create instances of `AMPCharacterHuman` and its child classes.
 // - Game Mode (e.g., `AMPGMGameplay`): The game mode will own and operate this factory to spawn human players or AI at the beginning of a match.
 // - Player Controller / AI Controller: Once a human character is spawned, it will be possessed by an appropriate controller.
@@ -33,8 +33,4 @@ class UFactoryHuman : public UMPFactory
 	
 public:
 	UFactoryHuman();
-
-public :
-	virtual AActor* SpawnMPActor(int actorCode, FVector actorLocation, FRotator actorRotation) override;
-	
 };
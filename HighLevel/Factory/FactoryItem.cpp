@@ -2,11 +2,5 @@
 
 UFactoryItem::UFactoryItem()
 {
-
-}
-
-AActor* UFactoryItem::SpawnMPActor(int actorCode,
-    FVector actorLocation, FRotator actorRotation)
-{
-    return nullptr;
+    registryCategory = EMPClassCategory::EItem;
 }
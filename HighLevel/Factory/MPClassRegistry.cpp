@@ -0,0 +1,155 @@
+#include "MPClassRegistry.h"
+#include "Engine/AssetManager.h"
+
+#include "../Managers/ManagerLog.h"
+#include "../../MPActor/Character/MPCharacterCat.h"
+#include "../../MPActor/Character/MPCharacterHuman.h"
+#include "../../MPActor/Item/MPItem.h"
+#include "../../MPActor/EnvActor/MPEnvActorComp.h"
+#include "../../MPActor/Ability/MPAbility.h"
+#include "../../MPActor/AI/MPAIController.h"
+
+UMPClassRegistry::UMPClassRegistry()
+{
+
+}
+
+// lookup
+template<typename TEnum, typename TClass>
+void UMPClassRegistry::FillTable(EMPClassCategory category, const TMap<TEnum, TSoftClassPtr<TClass>>& classMap)
+{
+    FMPClassTable& table = classTables[static_cast<int32>(category)];
+
+    for (const TPair<TEnum, TSoftClassPtr<TClass>>& eachEntry : classMap)
+    {
+        const int32 classCode = static_cast<int32>(eachEntry.Key);
+        if (classCode >= table.classPaths.Num())
+        {
+            table.classPaths.SetNum(classCode + 1);
+            table.loadedClasses.SetNumZeroed(classCode + 1);
+        }
+        table.classPaths[classCode] = eachEntry.Value.ToSoftObjectPath();
+    }
+}
+
+void UMPClassRegistry::BuildLookupTables()
+{
+    classTables.Reset();
+    classTables.SetNum(static_cast<int32>(EMPClassCategory::EMax));
+
+    FillTable(EMPClassCategory::ECat, catClasses);
+    FillTable(EMPClassCategory::EHuman, humanClasses);
+    FillTable(EMPClassCategory::EItem, itemClasses);
+    FillTable(EMPClassCategory::EEnvActor, envActorClasses);
+    FillTable(EMPClassCategory::EAbility, abilityClasses);
+    FillTable(EMPClassCategory::EAIController, aiControllerClasses);
+}
+
+UClass* UMPClassRegistry::ResolveClass(EMPClassCategory category, int32 classCode)
+{
+    if (classTables.Num() == 0)
+    {
+        BuildLookupTables();
+    }
+
+    if (!classTables.IsValidIndex(static_cast<int32>(category))) { return nullptr; }
+
+    FMPClassTable& table = classTables[static_cast<int32>(category)];
+    if (!table.classPaths.IsValidIndex(classCode)) { return nullptr; }
+
+    if (UClass* loadedClass = table.loadedClasses[classCode])
+    {
+        return loadedClass;
+    }
+
+    const FSoftObjectPath& classPath = table.classPaths[classCode];
+    if (classPath.IsNull()) { return nullptr; }
+
+    UClass* resolvedClass = Cast<UClass>(classPath.ResolveObject());
+    if (!resolvedClass)
+    {
+        MP_LOG_WARNING(TEXT("MPClassRegistry"), TEXT("Class %s was not preloaded, loading synchronously"), *classPath.ToString());
+        resolvedClass = Cast<UClass>(classPath.TryLoad());
+    }
+
+    table.loadedClasses[classCode] = resolvedClass;
+    return resolvedClass;
+}
+
+TArray<UClass*> UMPClassRegistry::GetLoadedClasses(EMPClassCategory category) const
+{
+    TArray<UClass*> result;
+    if (classTables.IsValidIndex(static_cast<int32>(category)))
+    {
+        for (UClass* eachClass : classTables[static_cast<int32>(category)].loadedClasses)
+        {
+            if (eachClass)
+            {
+                result.Add(eachClass);
+            }
+        }
+    }
+    return result;
+}
+
+// preload
+void UMPClassRegistry::PreloadAllClasses(FSimpleDelegate onPreloaded)
+{
+    BuildLookupTables();
+    preloadCompleted = false;
+    onPreloadedDelegate = onPreloaded;
+
+    TArray<FSoftObjectPath> pathsToLoad;
+    for (const FMPClassTable& eachTable : classTables)
+    {
+        for (const FSoftObjectPath& eachPath : eachTable.classPaths)
+        {
+            if (!eachPath.IsNull())
+            {
+                pathsToLoad.AddUnique(eachPath);
+            }
+        }
+    }
+
+    if (pathsToLoad.Num() == 0)
+    {
+        OnPreloadCompleted();
+        return;
+    }
+
+    MP_LOG_INFO(TEXT("MPClassRegistry"), TEXT("Preloading %d registered classes"), pathsToLoad.Num());
+
+    preloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(pathsToLoad,
+        FStreamableDelegate::CreateUObject(this, &UMPClassRegistry::OnPreloadCompleted));
+
+    // already in memory, the delegate will not fire
+    if (!preloadHandle.IsValid())
+    {
+        OnPreloadCompleted();
+    }
+}
+
+void UMPClassRegistry::OnPreloadCompleted()
+{
+    for (FMPClassTable& eachTable : classTables)
+    {
+        for (int32 i = 0; i < eachTable.classPaths.Num(); i++)
+        {
+            if (!eachTable.loadedClasses[i] && !eachTable.classPaths[i].IsNull())
+            {
+                eachTable.loadedClasses[i] = Cast<UClass>(eachTable.classPaths[i].ResolveObject());
+            }
+        }
+    }
+
+    preloadCompleted = true;
+    UManagerLog::LogInfo(TEXT("Registered classes preloaded"), TEXT("MPClassRegistry"));
+
+    onPreloadedDelegate.ExecuteIfBound();
+    onPreloadedDelegate.Unbind();
+}
+
+bool UMPClassRegistry::IsPreloaded() const
+{
+    return preloadCompleted;
+}
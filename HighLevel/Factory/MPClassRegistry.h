@@ -0,0 +1,105 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This is the data asset that tells every factory which class to spawn for a given enum value.
+// It replaces the per-factory switch statements and `TSubclassOf` properties: each gameplay enum
+// (`ECatRace`, `EHumanProfession`, `EMPItem`, `EEnvActor`, `EAbility`, `ETeam`) maps to a soft class
+// reference, so the classes are only loaded when a match needs them.
+//
+// How to utilize in Blueprint:
+// 1. Create a Data Asset from this class (e.g., `DA_MPClassRegistry`).
+// 2. Fill in every map with the Blueprint classes to spawn (e.g., `ECatExp` -> `BP_Cat_Exp`, `EDiedCat` -> `BP_Cat_Died`).
+// 3. Assign the asset to the `Class Registry` property of `BP_MPGMGameplay`. The Game Mode hands it to all factories and starts the async preload in `BeginPlay`.
+//
+// Necessary things to define:
+// - Every enum value that gameplay can ask for should have an entry; a missing entry resolves to nullptr and the spawn is skipped.
+//
+// How it interacts with other classes:
+// - UMPFactory: Factories call `ResolveClass` with their `registryCategory` and the `actorCode` they were given. The lookup is a flat array indexed by the enum value, so it is O(1).
+// - AMPGMGameplay: Owns the reference to this asset and calls `PreloadAllClasses` while the lobby is running, so `SetupPlayers` and `SpawnLobbyAIs` never hit a synchronous load.
+// - UAssetManager: The preload goes through the engine streamable manager. The returned handle is kept alive so the loaded classes stay in memory for the whole session.
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/StreamableManager.h"
+#include "../../CommonEnum.h"
+#include "MPClassRegistry.generated.h"
+
+class AMPCharacterCat;
+class AMPCharacterHuman;
+class AMPItem;
+class AMPEnvActorComp;
+class AMPAbility;
+class AMPAIController;
+
+// flat lookup for one category, indexed by the enum value
+USTRUCT()
+struct FMPClassTable
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+		TArray<FSoftObjectPath> classPaths;
+
+	UPROPERTY(Transient)
+		TArray<UClass*> loadedClasses;
+};
+
+UCLASS(BlueprintType)
+class UMPClassRegistry : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UMPClassRegistry();
+
+// soft class maps
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Registry Properties")
+		TMap<ECatRace, TSoftClassPtr<AMPCharacterCat>> catClasses;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Registry Properties")
+		TMap<EHumanProfession, TSoftClassPtr<AMPCharacterHuman>> humanClasses;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Registry Properties")
+		TMap<EMPItem, TSoftClassPtr<AMPItem>> itemClasses;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Registry Properties")
+		TMap<EEnvActor, TSoftClassPtr<AMPEnvActorComp>> envActorClasses;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Registry Properties")
+		TMap<EAbility, TSoftClassPtr<AMPAbility>> abilityClasses;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Registry Properties")
+		TMap<ETeam, TSoftClassPtr<AMPAIController>> aiControllerClasses;
+
+// lookup
+protected:
+	UPROPERTY(Transient)
+		TArray<FMPClassTable> classTables;
+
+	void BuildLookupTables();
+
+	template<typename TEnum, typename TClass>
+	void FillTable(EMPClassCategory category, const TMap<TEnum, TSoftClassPtr<TClass>>& classMap);
+
+public:
+	// resolve the class for a factory code, loading synchronously only if the preload has not covered it
+	UFUNCTION(BlueprintCallable, Category = "Registry Methods")
+		UClass* ResolveClass(EMPClassCategory category, int32 classCode);
+
+	// every class of one category that is already loaded, used to prewarm pools
+	UFUNCTION(BlueprintCallable, Category = "Registry Methods")
+		TArray<UClass*> GetLoadedClasses(EMPClassCategory category) const;
+
+// preload
+protected:
+	TSharedPtr<FStreamableHandle> preloadHandle;
+	FSimpleDelegate onPreloadedDelegate;
+	bool preloadCompleted = false;
+
+	void OnPreloadCompleted();
+
+public:
+	// async load every registered class, the delegate fires once all of them are in memory
+	void PreloadAllClasses(FSimpleDelegate onPreloaded);
+
+	UFUNCTION(BlueprintCallable, Category = "Registry Methods")
+		bool IsPreloaded() const;
+};
@@ -1,4 +1,9 @@
 #include "MPFactory.h"
+#include "Engine/World.h"
+
+#include "../Managers/ManagerLog.h"
+#include "../../MPActor/MPPoolable.h"
+#include "MPClassRegistry.h"
 
 UMPFactory::UMPFactory()
 {
@@ -13,5 +18,150 @@ void UMPFactory::SetGameWorld(UWorld* aWorld)
 AActor* UMPFactory::SpawnMPActor(int actorCode,
     FVector actorLocation, FRotator actorRotation)
 {
+    spawnedActor = SpawnPooledActor(ResolveSpawnClass(actorCode), actorLocation, actorRotation);
     return spawnedActor;
 }
+
+// class registry
+void UMPFactory::SetClassRegistry(UMPClassRegistry* aRegistry)
+{
+    classRegistry = aRegistry;
+}
+
+UClass* UMPFactory::ResolveSpawnClass(int actorCode) const
+{
+    if (!classRegistry)
+    {
+        MP_LOG_WARNING(TEXT("MPFactory"), TEXT("%s has no class registry"), *GetClass()->GetName());
+        return nullptr;
+    }
+    return classRegistry->ResolveClass(registryCategory, actorCode);
+}
+
+// pooling
+AActor* UMPFactory::SpawnPooledActor(TSubclassOf<AActor> spawnClass,
+    FVector actorLocation, FRotator actorRotation)
+{
+    if (!gameWorld || !spawnClass) { return nullptr; }
+
+    if (usePooling)
+    {
+        if (FMPActorPool* classPool = actorPools.Find(spawnClass.Get()))
+        {
+            while (classPool->freeActors.Num() > 0)
+            {
+                AActor* pooledActor = classPool->freeActors.Pop(false);
+                if (!IsValid(pooledActor))
+                {
+                    continue;
+                }
+
+                pooledActor->SetActorLocationAndRotation(actorLocation, actorRotation, false, nullptr, ETeleportType::ResetPhysics);
+                pooledActor->SetActorHiddenInGame(false);
+                pooledActor->SetActorEnableCollision(true);
+                pooledActor->SetActorTickEnabled(true);
+
+                if (IMPPoolable* poolable = Cast<IMPPoolable>(pooledActor))
+                {
+                    poolable->OnAcquiredFromPool();
+                }
+
+                poolHits++;
+                return pooledActor;
+            }
+        }
+        poolMisses++;
+    }
+
+    spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    return gameWorld->SpawnActor<AActor>(spawnClass, actorLocation, actorRotation, spawnParams);
+}
+
+void UMPFactory::ParkPooledActor(AActor* pooledActor)
+{
+    pooledActor->SetActorHiddenInGame(true);
+    pooledActor->SetActorEnableCollision(false);
+    pooledActor->SetActorTickEnabled(false);
+    pooledActor->SetActorLocation(poolParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
+
+    if (IMPPoolable* poolable = Cast<IMPPoolable>(pooledActor))
+    {
+        poolable->OnParkedInPool();
+    }
+}
+
+void UMPFactory::PrewarmPool(TSubclassOf<AActor> poolClass, int32 poolSize)
+{
+    if (!usePooling || !gameWorld || !poolClass) { return; }
+
+    if (!poolClass->ImplementsInterface(UMPPoolable::StaticClass()))
+    {
+        MP_LOG_WARNING(TEXT("MPFactory"), TEXT("Class %s is not poolable, prewarm skipped"), *poolClass->GetName());
+        return;
+    }
+
+    FMPActorPool& classPool = actorPools.FindOrAdd(poolClass.Get());
+    int32 toSpawn = FMath::Min(poolSize, poolMaxSize) - classPool.freeActors.Num();
+
+    spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    for (int32 i = 0; i < toSpawn; i++)
+    {
+        AActor* newActor = gameWorld->SpawnActor<AActor>(poolClass, poolParkingLocation, FRotator::ZeroRotator, spawnParams);
+        if (newActor)
+        {
+            // BeginPlay registered it like a live actor; release it the same way ReleaseMPActor does so it leaves the registry
+            if (IMPPoolable* poolable = Cast<IMPPoolable>(newActor))
+            {
+                poolable->OnReleasedToPool();
+            }
+            ParkPooledActor(newActor);
+            classPool.freeActors.Add(newActor);
+        }
+    }
+}
+
+void UMPFactory::PrewarmPools()
+{
+    if (!usePooling || !classRegistry) { return; }
+
+    for (UClass* eachClass : classRegistry->GetLoadedClasses(registryCategory))
+    {
+        PrewarmPool(eachClass, poolPrewarmSize);
+    }
+}
+
+bool UMPFactory::ReleaseMPActor(AActor* actorToRelease)
+{
+    if (!usePooling || !IsValid(actorToRelease)) { return false; }
+
+    IMPPoolable* poolable = Cast<IMPPoolable>(actorToRelease);
+    if (!poolable) { return false; }
+
+    FMPActorPool& classPool = actorPools.FindOrAdd(actorToRelease->GetClass());
+    if (classPool.freeActors.Num() >= poolMaxSize)
+    {
+        poolOverflows++;
+        return false;
+    }
+
+    poolable->OnReleasedToPool();
+    ParkPooledActor(actorToRelease);
+    classPool.freeActors.AddUnique(actorToRelease);
+    poolReleases++;
+    return true;
+}
+
+FString UMPFactory::GetPoolStats() const
+{
+    int32 pooledCount = 0;
+    for (const TPair<UClass*, FMPActorPool>& eachPool : actorPools)
+    {
+        pooledCount += eachPool.Value.freeActors.Num();
+    }
+
+    const int32 totalRequests = poolHits + poolMisses;
+    const float hitRate = totalRequests > 0 ? (float)poolHits / (float)totalRequests : 0.0f;
+
+    return FString::Printf(TEXT("%s pools: %d classes, %d parked, hits %d, misses %d (%.1f%% hit), releases %d, overflows %d"),
+        *GetClass()->GetName(), actorPools.Num(), pooledCount, poolHits, poolMisses, hitRate * 100.0f, poolReleases, poolOverflows);
+}
@@ -19,12 +19,26 @@
 // - AActor: The `SpawnMPActor` function is responsible for creating instances of AActor-derived classes.
 // - Child Factories (e.g., UFactoryAbility, UFactoryCat): These classes inherit from UMPFactory and implement the specific spawning logic for different types of actors. They override `SpawnMPActor` to handle different `actorCode` values.
 // - Managers (e.g., UManagerMatch): Managers will typically own instances of these factories to delegate the creation of game objects, centralizing the spawning logic.
+// - UMPClassRegistry: Child factories only set their `registryCategory`. The base `SpawnMPActor` reads `actorCode` as a value of that category's enum and resolves the class through the registry handed over by `SetClassRegistry`, so no factory carries its own switch or class properties.
+// - IMPPoolable: When `usePooling` is enabled, child factories spawn through `SpawnPooledActor`. Released actors are parked in a per-class pool and handed out again on the next spawn instead of being destroyed, and the `IMPPoolable` hooks reset their state on the way in and out.
 
 #include "CoreMinimal.h"
 #include "UObject/Class.h"
+#include "../../CommonEnum.h"
 #include "MPFactory.generated.h"
 
 class UWorld;
+class UMPClassRegistry;
+
+// One free list per pooled class
+USTRUCT()
+struct FMPActorPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+		TArray<AActor*> freeActors;
+};
 
 UCLASS(Blueprintable)
 class UMPFactory : public UObject
@@ -52,5 +66,65 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Common Methods")
 		virtual AActor* SpawnMPActor(int actorCode, FVector actorLocation, FRotator actorRotation);
-	
+
+// class registry
+protected:
+	UPROPERTY(BlueprintReadOnly, Category = "Registry Properties")
+		UMPClassRegistry* classRegistry = nullptr;
+
+	// which enum actorCode belongs to, set by each child factory
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Registry Properties")
+		EMPClassCategory registryCategory = EMPClassCategory::EMax;
+
+	UClass* ResolveSpawnClass(int actorCode) const;
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Registry Methods")
+		void SetClassRegistry(UMPClassRegistry* aRegistry);
+
+// pooling
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool Properties")
+		bool usePooling = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool Properties")
+		int32 poolPrewarmSize = 4;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool Properties")
+		int32 poolMaxSize = 32;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool Properties")
+		FVector poolParkingLocation = FVector(0.0f, 0.0f, -100000.0f);
+
+	UPROPERTY()
+		TMap<UClass*, FMPActorPool> actorPools;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Pool Properties")
+		int32 poolHits = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Pool Properties")
+		int32 poolMisses = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Pool Properties")
+		int32 poolReleases = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Pool Properties")
+		int32 poolOverflows = 0;
+
+	// acquire from the class pool when pooling is on, otherwise (or on a miss) spawn a new actor
+	AActor* SpawnPooledActor(TSubclassOf<AActor> spawnClass, FVector actorLocation, FRotator actorRotation);
+
+	void ParkPooledActor(AActor* pooledActor);
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Pool Methods")
+		bool IsPoolingEnabled() const { return usePooling; }
+
+	UFUNCTION(BlueprintCallable, Category = "Pool Methods")
+		void PrewarmPool(TSubclassOf<AActor> poolClass, int32 poolSize);
+
+	// prewarm every loaded registry class of this factory's category
+	UFUNCTION(BlueprintCallable, Category = "Pool Methods")
+		virtual void PrewarmPools();
+
+	// returns false when the actor was not taken by a pool and the caller should destroy it
+	UFUNCTION(BlueprintCallable, Category = "Pool Methods")
+		bool ReleaseMPActor(AActor* actorToRelease);
+
+	UFUNCTION(BlueprintCallable, Category = "Pool Methods")
+		FString GetPoolStats() const;
 };
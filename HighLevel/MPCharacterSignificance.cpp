@@ -0,0 +1,176 @@
+#include "MPCharacterSignificance.h"
+
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+
+#include "MPWorldRegistry.h"
+#include "../MPActor/Character/MPCharacter.h"
+
+DECLARE_STATS_GROUP(TEXT("MPSignificance"), STATGROUP_MPSignificance, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Characters High"), STAT_MPSignificanceHigh, STATGROUP_MPSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Characters Medium"), STAT_MPSignificanceMedium, STATGROUP_MPSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Characters Low"), STAT_MPSignificanceLow, STATGROUP_MPSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Characters Minimal"), STAT_MPSignificanceMinimal, STATGROUP_MPSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks High"), STAT_MPSignificanceTicksHigh, STATGROUP_MPSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Medium"), STAT_MPSignificanceTicksMedium, STATGROUP_MPSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Low"), STAT_MPSignificanceTicksLow, STATGROUP_MPSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Minimal"), STAT_MPSignificanceTicksMinimal, STATGROUP_MPSignificance);
+
+TStatId UMPCharacterSignificance::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMPCharacterSignificance, STATGROUP_Tickables);
+}
+
+void UMPCharacterSignificance::Tick(float deltaTime)
+{
+	Super::Tick(deltaTime);
+
+	rankTimeAccumulator += deltaTime;
+	if (rankTimeAccumulator < rankInterval) return;
+	rankTimeAccumulator = 0.0f;
+
+	GatherViewers();
+	RankCharacters();
+}
+
+void UMPCharacterSignificance::CountCharacterTick(ECharacterSignificance significance)
+{
+	switch (significance)
+	{
+	case ECharacterSignificance::High: INC_DWORD_STAT(STAT_MPSignificanceTicksHigh); break;
+	case ECharacterSignificance::Medium: INC_DWORD_STAT(STAT_MPSignificanceTicksMedium); break;
+	case ECharacterSignificance::Low: INC_DWORD_STAT(STAT_MPSignificanceTicksLow); break;
+	default: INC_DWORD_STAT(STAT_MPSignificanceTicksMinimal); break;
+	}
+}
+
+// ranking
+void UMPCharacterSignificance::GatherViewers()
+{
+	viewers.Reset();
+
+	UWorld* world = GetWorld();
+	if (!world) return;
+
+	for (FConstPlayerControllerIterator iterator = world->GetPlayerControllerIterator(); iterator; ++iterator)
+	{
+		const APlayerController* playerController = iterator->Get();
+		if (!playerController) continue;
+
+		FViewer viewer;
+		viewer.viewPawn = playerController->GetPawn();
+
+		if (playerController->IsLocalController())
+		{
+			FRotator viewRotation;
+			playerController->GetPlayerViewPoint(viewer.location, viewRotation);
+			viewer.direction = viewRotation.Vector();
+		}
+		else if (viewer.viewPawn)
+		{
+			// the server has no camera for a remote player, its pawn and aim stand in for it
+			viewer.location = viewer.viewPawn->GetPawnViewLocation();
+			viewer.direction = playerController->GetControlRotation().Vector();
+		}
+		else
+		{
+			continue;
+		}
+
+		viewers.Add(viewer);
+	}
+}
+
+void UMPCharacterSignificance::RankCharacters()
+{
+	UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+	if (!registry) return;
+
+	uint32 bucketCounts[4] = { 0, 0, 0, 0 };
+
+	for (AMPCharacter* character : registry->GetCharacters())
+	{
+		if (!IsValid(character)) continue;
+
+		const ECharacterSignificance significance = RankCharacter(character);
+		++bucketCounts[static_cast<uint8>(significance)];
+
+		if (significance != character->GetSignificance())
+		{
+			character->SetSignificance(significance, GetTickInterval(significance), GetAnimTickInterval(significance));
+		}
+	}
+
+	SET_DWORD_STAT(STAT_MPSignificanceHigh, bucketCounts[0]);
+	SET_DWORD_STAT(STAT_MPSignificanceMedium, bucketCounts[1]);
+	SET_DWORD_STAT(STAT_MPSignificanceLow, bucketCounts[2]);
+	SET_DWORD_STAT(STAT_MPSignificanceMinimal, bucketCounts[3]);
+}
+
+ECharacterSignificance UMPCharacterSignificance::RankCharacter(const AMPCharacter* character) const
+{
+	// nobody to measure from (menus, a server before anyone spawned), leave everything at full rate
+	if (viewers.Num() == 0 || character->IsLocallyControlled()) return ECharacterSignificance::High;
+
+	const FVector location = character->GetActorLocation();
+	float nearestDistanceSquared = MAX_flt;
+	bool isInView = false;
+
+	for (const FViewer& viewer : viewers)
+	{
+		if (viewer.viewPawn == character) return ECharacterSignificance::High;
+
+		const FVector toCharacter = location - viewer.location;
+		const float distanceSquared = toCharacter.SizeSquared();
+		nearestDistanceSquared = FMath::Min(nearestDistanceSquared, distanceSquared);
+
+		if (!isInView && FVector::DotProduct(toCharacter.GetSafeNormal(), viewer.direction) >= viewConeCos)
+		{
+			isInView = true;
+		}
+	}
+
+	ECharacterSignificance significance = ECharacterSignificance::Minimal;
+	if (nearestDistanceSquared < FMath::Square(highDistance))
+	{
+		significance = isInView ? ECharacterSignificance::High : ECharacterSignificance::Medium;
+	}
+	else if (nearestDistanceSquared < FMath::Square(mediumDistance))
+	{
+		significance = isInView ? ECharacterSignificance::Medium : ECharacterSignificance::Low;
+	}
+	else if (nearestDistanceSquared < FMath::Square(lowDistance))
+	{
+		significance = ECharacterSignificance::Low;
+	}
+
+	// a bot nobody controls matters less than a player at the same spot
+	if (!character->IsPlayerControlled() && significance != ECharacterSignificance::Minimal)
+	{
+		significance = static_cast<ECharacterSignificance>(static_cast<uint8>(significance) + 1);
+	}
+	return significance;
+}
+
+float UMPCharacterSignificance::GetTickInterval(ECharacterSignificance significance) const
+{
+	switch (significance)
+	{
+	case ECharacterSignificance::High: return 0.0f;
+	case ECharacterSignificance::Medium: return mediumTickInterval;
+	case ECharacterSignificance::Low: return lowTickInterval;
+	default: return minimalTickInterval;
+	}
+}
+
+float UMPCharacterSignificance::GetAnimTickInterval(ECharacterSignificance significance) const
+{
+	switch (significance)
+	{
+	case ECharacterSignificance::High: return 0.0f;
+	case ECharacterSignificance::Medium: return mediumAnimTickInterval;
+	case ECharacterSignificance::Low: return lowAnimTickInterval;
+	default: return minimalAnimTickInterval;
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This world subsystem ranks every character by how much it matters to the viewers of this machine
+// and lowers the tick rate of the ones that do not. A viewer is a local player's camera, or on the
+// server every player's pawn, so gameplay for remote players is never throttled.
+// - High: within `highDistance` and in a viewer's view cone, or locally controlled. Ticks every frame.
+// - Medium / Low: nearer than `mediumDistance` / `lowDistance`. Ticks at `mediumTickInterval` / `lowTickInterval`.
+// - Minimal: beyond `lowDistance`. Ticks at `minimalTickInterval` and skips cosmetic work (hand targets, simulated air and move state).
+// Bots rank one bucket lower than players at the same spot. Simulated proxies also get their skeletal mesh tick throttled per bucket.
+//
+// How to utilize in Blueprint:
+// - It is not exposed to Blueprint. Read a character's bucket with `GetSignificance`.
+//
+// Necessary things to define:
+// - Optional tuning in DefaultGame.ini under `[/Script/MeowPhone.MPCharacterSignificance]`: distances, `viewConeCos`, the tick intervals and `rankInterval`.
+//
+// How it interacts with other classes:
+// - UMPWorldRegistry: The characters ranked are the registry's character list.
+// - AMPCharacter: `SetSignificance` applies the tick intervals; `ShouldTickCosmetics` gates the cosmetic parts of `Tick` in the cat and human.
+// - `stat MPSignificance`: How many characters sit in each bucket and how many character ticks each bucket ran this frame.
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "../CommonEnum.h"
+#include "MPCharacterSignificance.generated.h"
+
+class AMPCharacter;
+
+UCLASS(Config = Game)
+class UMPCharacterSignificance : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float deltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// called by every character tick, feeds the per-bucket tick counters
+	static void CountCharacterTick(ECharacterSignificance significance);
+
+// config
+protected:
+	UPROPERTY(Config)
+		float rankInterval = 0.25f;
+	UPROPERTY(Config)
+		float highDistance = 2000.0f;
+	UPROPERTY(Config)
+		float mediumDistance = 5000.0f;
+	UPROPERTY(Config)
+		float lowDistance = 10000.0f;
+	// cosine of the half angle of a viewer's view cone
+	UPROPERTY(Config)
+		float viewConeCos = 0.5f;
+
+	UPROPERTY(Config)
+		float mediumTickInterval = 1.0f / 30.0f;
+	UPROPERTY(Config)
+		float lowTickInterval = 0.1f;
+	UPROPERTY(Config)
+		float minimalTickInterval = 0.25f;
+
+	// skeletal mesh tick of simulated proxies, High always animates every frame
+	UPROPERTY(Config)
+		float mediumAnimTickInterval = 0.0f;
+	UPROPERTY(Config)
+		float lowAnimTickInterval = 1.0f / 15.0f;
+	UPROPERTY(Config)
+		float minimalAnimTickInterval = 0.2f;
+
+// ranking
+protected:
+	struct FViewer
+	{
+		FVector location = FVector::ZeroVector;
+		FVector direction = FVector::ForwardVector;
+		const AActor* viewPawn = nullptr;
+	};
+
+	TArray<FViewer> viewers;
+	float rankTimeAccumulator = 0.0f;
+
+	void GatherViewers();
+	void RankCharacters();
+	ECharacterSignificance RankCharacter(const AMPCharacter* character) const;
+	float GetTickInterval(ECharacterSignificance significance) const;
+	float GetAnimTickInterval(ECharacterSignificance significance) const;
+};
@@ -0,0 +1,111 @@
+#include "MPEffectScheduler.h"
+
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+
+void UMPEffectScheduler::Deinitialize()
+{
+	effects.Empty();
+	fireHeap.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UMPEffectScheduler::IsTickable() const
+{
+	return Super::IsTickable() && fireHeap.Num() > 0;
+}
+
+TStatId UMPEffectScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMPEffectScheduler, STATGROUP_Tickables);
+}
+
+void UMPEffectScheduler::Tick(float deltaTime)
+{
+	Super::Tick(deltaTime);
+	FireDueEffects(GetServerTime());
+}
+
+UMPEffectScheduler* UMPEffectScheduler::Get(const UObject* worldContextObject)
+{
+	UWorld* world = worldContextObject ? worldContextObject->GetWorld() : nullptr;
+	return world ? world->GetSubsystem<UMPEffectScheduler>() : nullptr;
+}
+
+float UMPEffectScheduler::GetServerTime(const UWorld* world)
+{
+	if (!world) return 0.0f;
+
+	if (const AGameStateBase* gameState = world->GetGameState())
+	{
+		return gameState->GetServerWorldTimeSeconds();
+	}
+	return world->GetTimeSeconds();
+}
+
+FMPEffectHandle UMPEffectScheduler::Schedule(float endServerTime, FSimpleDelegate onExpired, float pulseInterval, FSimpleDelegate onPulse)
+{
+	FMPEffectHandle handle;
+	handle.id = nextEffectId++;
+
+	FScheduledEffect& effect = effects.Add(handle.id);
+	effect.endServerTime = endServerTime;
+	effect.pulseInterval = onPulse.IsBound() ? FMath::Max(pulseInterval, 0.0f) : 0.0f;
+	effect.onExpired = MoveTemp(onExpired);
+	effect.onPulse = MoveTemp(onPulse);
+
+	const float firstFire = effect.pulseInterval > 0.0f
+		? FMath::Min(GetServerTime() + effect.pulseInterval, endServerTime)
+		: endServerTime;
+	PushFireEntry(firstFire, handle.id);
+	return handle;
+}
+
+void UMPEffectScheduler::Cancel(FMPEffectHandle& handle)
+{
+	if (handle.IsValid())
+	{
+		// the heap entry is skipped when it comes up
+		effects.Remove(handle.id);
+	}
+	handle.Invalidate();
+}
+
+void UMPEffectScheduler::PushFireEntry(float fireServerTime, uint64 id)
+{
+	FFireEntry entry;
+	entry.fireServerTime = fireServerTime;
+	entry.id = id;
+	fireHeap.HeapPush(entry);
+}
+
+void UMPEffectScheduler::FireDueEffects(float now)
+{
+	// callbacks may schedule or cancel, so nothing is held across them
+	while (fireHeap.Num() > 0 && fireHeap.HeapTop().fireServerTime <= now)
+	{
+		FFireEntry due;
+		fireHeap.HeapPop(due, false);
+
+		FScheduledEffect* effect = effects.Find(due.id);
+		if (!effect) continue;
+
+		if (due.fireServerTime < effect->endServerTime)
+		{
+			const float nextFire = FMath::Min(due.fireServerTime + effect->pulseInterval, effect->endServerTime);
+			const FSimpleDelegate onPulse = effect->onPulse;
+			PushFireEntry(nextFire, due.id);
+			onPulse.ExecuteIfBound();
+			continue;
+		}
+
+		const FScheduledEffect expired = MoveTemp(*effect);
+		effects.Remove(due.id);
+		if (expired.pulseInterval > 0.0f)
+		{
+			expired.onPulse.ExecuteIfBound();
+		}
+		expired.onExpired.ExecuteIfBound();
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This world subsystem runs every usage duration, interaction duration and cooldown of items,
+// abilities and env actors. An effect is registered once with its end time and the scheduler calls
+// back when it expires, instead of each actor re-arming its own one second timer for every step of
+// the countdown. Pending effects sit in a min-heap keyed on server time, so a frame only looks at the
+// effects that are due.
+//
+// How to utilize in Blueprint:
+// - It is not exposed to Blueprint. Actors expose the remaining time with their own `Get...RemainingTime` getters.
+//
+// Necessary things to define:
+// - Nothing. Unreal instantiates one scheduler per world automatically.
+//
+// How it interacts with other classes:
+// - AMPItem, AMPAbility, AMPEnvActorComp: `Schedule` their duration and cooldown with an end time from `GetServerTime`, and `Cancel` them when they go back to the pool. Duration effects also get a pulse every second, which applies the effect again.
+// - Replication: The actors replicate only the end timestamp of each window. A client derives the remaining time from it and `AGameStateBase::GetServerWorldTimeSeconds`, the same clock as the Game State's `phaseClock`.
+// - Callbacks are bound weakly to their actor, so an effect whose actor is destroyed is dropped silently.
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MPEffectScheduler.generated.h"
+
+// identifies one scheduled effect, stays invalid until Schedule fills it
+struct FMPEffectHandle
+{
+	uint64 id = 0;
+
+	bool IsValid() const { return id != 0; }
+	void Invalidate() { id = 0; }
+};
+
+UCLASS()
+class UMPEffectScheduler : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float deltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	static UMPEffectScheduler* Get(const UObject* worldContextObject);
+
+	// time base of every end timestamp, server world time as the Game State sees it on this machine
+	static float GetServerTime(const UWorld* world);
+	float GetServerTime() const { return GetServerTime(GetWorld()); }
+
+	// onExpired fires once at endServerTime; with a pulse interval, onPulse fires every interval up to and including endServerTime, just before onExpired
+	FMPEffectHandle Schedule(float endServerTime, FSimpleDelegate onExpired, float pulseInterval = 0.0f, FSimpleDelegate onPulse = FSimpleDelegate());
+	// safe with an invalid or already fired handle, always invalidates it
+	void Cancel(FMPEffectHandle& handle);
+	bool IsScheduled(const FMPEffectHandle& handle) const { return handle.IsValid() && effects.Contains(handle.id); }
+
+	int32 GetNumScheduled() const { return effects.Num(); }
+
+protected:
+	struct FScheduledEffect
+	{
+		float endServerTime = 0.0f;
+		float pulseInterval = 0.0f;
+		FSimpleDelegate onExpired;
+		FSimpleDelegate onPulse;
+	};
+
+	// one entry per scheduled effect, a cancelled effect leaves its entry behind until it reaches the top
+	struct FFireEntry
+	{
+		float fireServerTime = 0.0f;
+		uint64 id = 0;
+
+		bool operator<(const FFireEntry& other) const { return fireServerTime < other.fireServerTime; }
+	};
+
+	TMap<uint64, FScheduledEffect> effects;
+	TArray<FFireEntry> fireHeap;
+	uint64 nextEffectId = 1;
+
+	void PushFireEntry(float fireServerTime, uint64 id);
+	void FireDueEffects(float now);
+};
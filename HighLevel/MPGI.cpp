@@ -56,6 +56,7 @@ void UMPGI::Shutdown()
     SaveGame();
     
     UManagerLog::LogInfo(TEXT("Game Instance shutting down"), TEXT("MPGI"));
+    UManagerLog::ShutdownLogging();
 }
 
 // save file section
@@ -142,7 +143,7 @@ void UMPGI::SetCurrentLanguage(ELanguage newLanguage)
 	// Save the change immediately
 	SaveGame();
 	
-	UManagerLog::LogInfo(FString::Printf(TEXT("Language changed to %d and saved"), (int32)newLanguage), TEXT("MPGI"));
+	MP_LOG_INFO(TEXT("MPGI"), TEXT("Language changed to %d and saved"), (int32)newLanguage);
 }
 
 FString UMPGI::GetCurPlayerName()
@@ -279,7 +280,7 @@ void UMPGI::JoinSessions(int sessionIndex)
 					
 					IOnlineSubsystem::Get()->GetSessionInterface()->JoinSession(*localPlayer->GetPreferredUniqueNetId(), FName(*sessionList[sessionIndex].sessionName), searchSettings->SearchResults[sessionIndex]);
 
-					UManagerLog::LogInfo(FString::Printf(TEXT("Attempting to join session %d"), sessionIndex), TEXT("MPGI"));
+					MP_LOG_INFO(TEXT("MPGI"), TEXT("Attempting to join session %d"), sessionIndex);
 				}
 				else
 				{
@@ -374,7 +375,7 @@ void UMPGI::SearchForSessionsCompleted(bool searchCompleted)
 				sessionList.Add(sessionInfo);
 			}
 			
-					UManagerLog::LogInfo(FString::Printf(TEXT("Found %d sessions"), sessionList.Num()), TEXT("MPGI"));
+					MP_LOG_INFO(TEXT("MPGI"), TEXT("Found %d sessions"), sessionList.Num());
 	}
 	
 			// Notify the HUD that search is complete
@@ -486,7 +487,7 @@ FSessionInfo UMPGI::GetSessionInfo(int32 index) const
 		return sessionList[index];
 	}
 	
-	UManagerLog::LogWarning(FString::Printf(TEXT("Invalid session index: %d"), index), TEXT("MPGI"));
+	MP_LOG_WARNING(TEXT("MPGI"), TEXT("Invalid session index: %d"), index);
 	return FSessionInfo();
 }
 
@@ -539,7 +540,7 @@ void UMPGI::OpenLevel(EGameLevel levelType)
 	if (!levelName.IsEmpty())
 	{
 		UGameplayStatics::OpenLevel(GetWorld(), FName(*levelName));
-		UManagerLog::LogInfo(FString::Printf(TEXT("Opening level: %s"), *levelName), TEXT("MPGI"));
+		MP_LOG_INFO(TEXT("MPGI"), TEXT("Opening level: %s"), *levelName);
 	}
 	else
 	{
@@ -637,5 +638,5 @@ bool UMPGI::IsHost() const
 void UMPGI::SetHostPlayerID(const FString& hostID)
 {
 	hostPlayerID = hostID;
-	UManagerLog::LogInfo(FString::Printf(TEXT("Host player ID set to: %s"), *hostID), TEXT("MPGI"));
+	MP_LOG_INFO(TEXT("MPGI"), TEXT("Host player ID set to: %s"), *hostID);
 }
\ No newline at end of file
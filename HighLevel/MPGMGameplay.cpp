@@ -13,6 +13,7 @@
 #include "Managers/ManagerPreview.h"
 #include "Managers/ManagerAIController.h"
 #include "Managers/ManagerMatch.h"
+#include "Managers/ManagerMatchClock.h"
 
 #include "Factory/FactoryHuman.h"
 #include "Factory/FactoryCat.h"
@@ -20,6 +21,7 @@
 #include "Factory/FactoryItem.h"
 #include "Factory/FactoryAbility.h"
 #include "Factory/FactoryAIController.h"
+#include "Factory/MPClassRegistry.h"
 
 #include "../MPActor/Player/MPControllerPlayer.h"
 #include "../MPActor/Player/MPPlayerState.h"
@@ -108,6 +110,7 @@ void AMPGMGameplay::PostLogin(APlayerController* newPlayer)
 				ManagerLobby->AutoAssignTeams();
 				curPlayer->AttachHUD(EHUDType::ELobby, 0);
 				curPlayer->LobbyStartUpdate();
+				ManagerLobby->SyncLobbyRoster();
 			}
 			else
 			{
@@ -126,6 +129,7 @@ void AMPGMGameplay::PostLogin(APlayerController* newPlayer)
 				ManagerLobby->AutoAssignTeams();
 				curPlayer->AttachHUD(EHUDType::ELobby, 0);
 				curPlayer->LobbyStartUpdate();
+				ManagerLobby->SyncLobbyRoster();
 			}
 			else
 			{
@@ -148,6 +152,17 @@ void AMPGMGameplay::Logout(AController* exiting)
 		ManagerPreview->FreePreviewSlot(curPlayer);
 		// Check if the exiting player was a cat player
 		AMPPlayerState* playerState = Cast<AMPPlayerState>(curPlayer->PlayerState);
+
+		// an alive human leaving counts as one human out for the win condition
+		if (playerState && playerState->playerTeam == ETeam::EHuman)
+		{
+			AMPCharacterHuman* humanCharacter = Cast<AMPCharacterHuman>(curPlayer->GetPawn());
+			if (humanCharacter && !humanCharacter->IsDead())
+			{
+				ManagerMatch->RegisterHumanDeath();
+			}
+		}
+
 		if (playerState && playerState->playerTeam == ETeam::ECat)
 		{
 			// Check if this cat was being held by any human
@@ -174,23 +189,19 @@ void AMPGMGameplay::Logout(AController* exiting)
 			// Update human team objective - reduce total cat players
 			if (theGameState && theGameState->totalCatPlayers > 0)
 			{
-				theGameState->totalCatPlayers--;
-				UManagerLog::LogInfo(FString::Printf(TEXT("Cat player disconnected! Human objective updated: %d cat players remaining"), theGameState->totalCatPlayers), TEXT("MPGMGameplay"));
-				
-				// Recalculate percentage
-				if (theGameState->totalCatPlayers > 0)
-				{
-					theGameState->caughtCatsPercentage = (float)theGameState->caughtCats / (float)theGameState->totalCatPlayers;
-				}
-				else
-				{
-					theGameState->caughtCatsPercentage = 1.0f; // All cats disconnected, human team wins
-				}
+				theGameState->RemoveCatPlayer();
+				MP_LOG_INFO(TEXT("MPGMGameplay"), TEXT("Cat player disconnected! Human objective updated: %d cat players remaining"), theGameState->totalCatPlayers);
 			}
 		}
 		
 		allPlayersControllers.Remove(curPlayer);
 		RemoveControlledCharacters(curPlayer);
+
+		// the leaving player drops out of every lobby list as one removed roster entry
+		if (theGameState && theGameState->curGameplayStatus == EGPStatus::ELobby && ManagerLobby)
+		{
+			ManagerLobby->SyncLobbyRoster();
+		}
 	}
 
 	bool isGameEnd = ManagerMatch->CheckIfGameEnd();
@@ -203,6 +214,7 @@ void AMPGMGameplay::BeginPlay()
 	InitializeGameState();
 	InitializeAllManagers();
 	InitializeFactoryInstances();
+	PreloadFactoryClasses();
 
 	if (ManagerPreview)
 	{
@@ -250,6 +262,15 @@ void AMPGMGameplay::InitializeAllManagers()
 		}
 	}
 
+	if (!ManagerMatchClock)
+	{
+		ManagerMatchClock = NewObject<UManagerMatchClock>(this, UManagerMatchClock::StaticClass());
+		if (ManagerMatchClock)
+		{
+			ManagerMatchClock->InitializeManager(this);
+		}
+	}
+
 	if (!ManagerAIController)
 	{
 		ManagerAIController = NewObject<UManagerAIController>(this, UManagerAIController::StaticClass());
@@ -298,31 +319,61 @@ void AMPGMGameplay::InitializeFactoryInstances()
     {
         aiControllerFactoryInstance = NewObject<UFactoryAIController>(this, aiControllerFactoryClass);
         aiControllerFactoryInstance->SetGameWorld(GetWorld());
+        aiControllerFactoryInstance->SetClassRegistry(classRegistry);
     }
 	if (!humanFactoryInstance && humanFactoryClass)
     {
         humanFactoryInstance = NewObject<UFactoryHuman>(this, humanFactoryClass);
         humanFactoryInstance->SetGameWorld(GetWorld());
+        humanFactoryInstance->SetClassRegistry(classRegistry);
     }
     if (!catFactoryInstance && catFactoryClass)
     {
         catFactoryInstance = NewObject<UFactoryCat>(this, catFactoryClass);
         catFactoryInstance->SetGameWorld(GetWorld());
+        catFactoryInstance->SetClassRegistry(classRegistry);
     }
     if (!environmentFactoryInstance && environmentFactoryClass)
     {
         environmentFactoryInstance = NewObject<UFactoryEnvironment>(this, environmentFactoryClass);
         environmentFactoryInstance->SetGameWorld(GetWorld());
+        environmentFactoryInstance->SetClassRegistry(classRegistry);
     }
     if (!itemFactoryInstance && itemFactoryClass)
     {
         itemFactoryInstance = NewObject<UFactoryItem>(this, itemFactoryClass);
         itemFactoryInstance->SetGameWorld(GetWorld());
+        itemFactoryInstance->SetClassRegistry(classRegistry);
     }
     if (!abilityFactoryInstance && abilityFactoryClass)
     {
         abilityFactoryInstance = NewObject<UFactoryAbility>(this, abilityFactoryClass);
         abilityFactoryInstance->SetGameWorld(GetWorld());
+        abilityFactoryInstance->SetClassRegistry(classRegistry);
+    }
+}
+
+void AMPGMGameplay::PreloadFactoryClasses()
+{
+    if (!classRegistry)
+    {
+        UManagerLog::LogError(TEXT("No class registry assigned, factories cannot spawn"), TEXT("MPGMGameplay"));
+        return;
+    }
+
+    classRegistry->PreloadAllClasses(FSimpleDelegate::CreateUObject(this, &AMPGMGameplay::OnFactoryClassesPreloaded));
+}
+
+void AMPGMGameplay::OnFactoryClassesPreloaded()
+{
+    // pools can only be filled once the pooled classes are in memory
+    TArray<UMPFactory*> pooledFactories = { environmentFactoryInstance, itemFactoryInstance, abilityFactoryInstance };
+    for (UMPFactory* eachFactory : pooledFactories)
+    {
+        if (eachFactory)
+        {
+            eachFactory->PrewarmPools();
+        }
     }
 }
 
@@ -379,6 +430,32 @@ AMPAbility* AMPGMGameplay::SpawnAbility(AActor* abilityOwner, EAbility abilityTa
 	return nullptr;
 }
 
+	// factory release
+bool AMPGMGameplay::ReleaseEnvironment(AMPEnvActorComp* envActor)
+{
+	return environmentFactoryInstance && environmentFactoryInstance->ReleaseMPActor(envActor);
+}
+bool AMPGMGameplay::ReleaseItem(AMPItem* item)
+{
+	return itemFactoryInstance && itemFactoryInstance->ReleaseMPActor(item);
+}
+bool AMPGMGameplay::ReleaseAbility(AMPAbility* ability)
+{
+	return abilityFactoryInstance && abilityFactoryInstance->ReleaseMPActor(ability);
+}
+
+void AMPGMGameplay::DisplayPoolStatus()
+{
+	TArray<UMPFactory*> pooledFactories = { environmentFactoryInstance, itemFactoryInstance, abilityFactoryInstance };
+	for (UMPFactory* eachFactory : pooledFactories)
+	{
+		if (eachFactory && eachFactory->IsPoolingEnabled())
+		{
+			UManagerLog::LogInfo(eachFactory->GetPoolStats(), TEXT("MPGMGameplay"));
+		}
+	}
+}
+
 // game process
 	// lobby
 // All lobby logic is now in UManagerLobby
@@ -424,6 +501,11 @@ void AMPGMGameplay::RegisterPlayerDeath(AMPControllerPlayer* diedPlayer,
 	if(ManagerMatch) ManagerMatch->RegisterPlayerDeath(diedPlayer, diedPlayerLocation, diedPlayerRotation);
 }
 
+void AMPGMGameplay::RegisterHumanDeath()
+{
+	if(ManagerMatch) ManagerMatch->RegisterHumanDeath();
+}
+
 void AMPGMGameplay::DisplayProgressionStatus()
 {
 	if(ManagerMatch) ManagerMatch->DisplayProgressionStatus();
@@ -453,7 +535,7 @@ void AMPGMGameplay::RestartLobby()
 	if (theGameState)
 	{
 		theGameState->curGameplayStatus = EGPStatus::ELobby;
-		theGameState->isMostPlayerReady = false;
+		theGameState->SetMostPlayerReady(false);
 		theGameState->curReadyTime = 0;
 		theGameState->curCustomCharacterTime = 0;
 		theGameState->curPrepareTime = 0;
@@ -464,6 +546,7 @@ void AMPGMGameplay::RestartLobby()
 	if (GetWorld())
 	{
 		ManagerLobby->ClearAllTimers();
+		ManagerMatchClock->StopPhase();
 	}
 	
 	// Reset all players
@@ -497,7 +580,7 @@ bool AMPGMGameplay::AddBot(ETeam team)
         bool Result = ManagerAIController->AddBot(team);
         if (Result && ManagerLobby)
         {
-            ManagerLobby->BroadcastPlayerListUpdate();
+            ManagerLobby->SyncLobbyRoster();
         }
         return Result;
     }
@@ -511,7 +594,7 @@ bool AMPGMGameplay::RemoveBot(int32 playerIndex)
         bool Result = ManagerAIController->RemoveBot(playerIndex);
         if (Result && ManagerLobby)
         {
-            ManagerLobby->BroadcastPlayerListUpdate();
+            ManagerLobby->SyncLobbyRoster();
         }
         return Result;
     }
@@ -561,20 +644,6 @@ TArray<AMPControllerPlayer*> AMPGMGameplay::GetCatPlayers() const
 	return catPlayers;
 }
 
-void AMPGMGameplay::ClientUpdateCustomizationCountdown_Implementation(int32 secondsRemaining)
-{
-	UManagerLog::LogDebug(FString::Printf(TEXT("Client received customization countdown update: %d"), secondsRemaining), TEXT("MPGMGameplay"));
-	
-	// Update countdown on all player HUDs on this client
-	for (AMPControllerPlayer* eachPlayer : allPlayersControllers)
-	{
-		if (eachPlayer)
-		{
-			eachPlayer->UpdateLobbyHUDCountdownText(secondsRemaining);
-		}
-	}
-}
-
 int32 AMPGMGameplay::GetPlayerPreviewSlot(AMPControllerPlayer* Player) const
 {
     if (ManagerPreview)
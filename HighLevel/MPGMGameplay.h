@@ -12,6 +12,7 @@
 // 2. This Blueprint must be set as the "Default Game Mode" for your main gameplay level.
 // 3. In the Blueprint editor for `BP_MPGMGameplay`, you MUST configure several key properties:
 //    - **Factory Classes**: Assign all the `...FactoryClass` properties with their corresponding Factory Blueprints (e.g., set `Cat Factory Class` to `BP_FactoryCat`).
+//    - **Class Registry**: Assign the `UMPClassRegistry` data asset that maps every race, profession, item, environment actor, ability and AI team to the class the factories spawn.
 //    - **Spawn Points**: Populate the `allHumanSpawnLocations`, `allCatSpawnLocations`, and their corresponding rotation arrays. These are typically set by creating `TargetPoint` actors in your level, creating variables in the Game Mode Blueprint to hold references to them, and then populating the arrays from those references in the `BeginPlay` event. The same applies to `characterPreviewLocations`.
 //    - **Debug Settings**: Configure the debug modes as needed for testing.
 //
@@ -19,6 +20,7 @@
 // - AMPGM: Inherits the base functionality, including the cached Game Instance reference.
 // - Managers (UManagerLobby, UManagerMatch, etc.): This class creates and owns instances of all the major manager classes. It acts as a central hub, allowing managers to communicate with each other through it (e.g., `GetManagerLobby()`). It calls `InitializeAllManagers` at the start to set them up.
 // - Factories (UFactoryCat, UFactoryItem, etc.): It holds the `TSubclassOf` for each factory and is responsible for creating the factory instances. It exposes wrapper functions like `SpawnItem` and `SpawnAbility` that delegate the actual spawning work to the appropriate factory instance.
+// - UMPClassRegistry: Handed to every factory on creation. `BeginPlay` starts an async preload of all registered classes so the lobby time covers the loading, and the factory pools are prewarmed once it completes.
 // - AMPGS (Game State): It holds a reference to the Game State and is responsible for initializing it. The Game State is where replicated data visible to all clients is stored.
 // - AMPControllerPlayer: It manages the list of all connected player controllers, handling `PostLogin` (when a player joins) and `Logout` (when a player leaves).
 // - Player States & Characters: It keeps track of all player characters and controllers in the game.
@@ -36,6 +38,7 @@ class UFactoryCat;
 class UFactoryEnvironment;
 class UFactoryItem;
 class UFactoryAbility;
+class UMPClassRegistry;
 
 class AMPControllerPlayer;
 class AMPCharacter;
@@ -48,6 +51,7 @@ class UManagerLobby;
 class UManagerPreview;
 class UManagerMatch;
 class UManagerAIController;
+class UManagerMatchClock;
 
 // Old deprecated enum names removed. Use correct ones below.
 // Correct forward declarations for enums used in this header
@@ -100,6 +104,14 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Factory Methods")
 	void InitializeFactoryInstances();
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Factory Properties")
+		UMPClassRegistry* classRegistry;
+
+	// async load every registered class before SetupPlayers / SpawnLobbyAIs need them
+	UFUNCTION(BlueprintCallable, Category = "Factory Methods")
+	void PreloadFactoryClasses();
+	void OnFactoryClassesPreloaded();
+
 public:
 	// Factory instances now public to allow access from manager classes
 	UPROPERTY(BlueprintReadWrite, Category = "Factory Properties")
@@ -150,6 +162,8 @@ protected:
 	UManagerPreview* ManagerPreview;
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Managers")
 	UManagerMatch* ManagerMatch;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Managers")
+	UManagerMatchClock* ManagerMatchClock;
 
 public:
 	UFUNCTION(BlueprintCallable, Category = "Manager Methods")
@@ -160,6 +174,8 @@ public:
 	UManagerPreview* GetManagerPreview() const { return ManagerPreview; }
 	UFUNCTION(BlueprintCallable, Category = "Manager Methods")
 	UManagerMatch* GetManagerMatch() const { return ManagerMatch; }
+	UFUNCTION(BlueprintCallable, Category = "Manager Methods")
+	UManagerMatchClock* GetManagerMatchClock() const { return ManagerMatchClock; }
 
 // manager lobby
 protected:
@@ -217,11 +233,6 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Preview")
     void RequestPreviewCharacterUpdate(AMPControllerPlayer* Player, ETeam Team, int CatRace, int HumanProfession, int Hat);
 
-public:
-	// Client RPC for countdown updates
-	UFUNCTION(Client, Reliable, Category = "Lobby Methods")
-	void ClientUpdateCustomizationCountdown(int32 secondsRemaining);
-
 // manager ai controller
 protected:
 
@@ -253,6 +264,16 @@ public :
 	UFUNCTION(BlueprintCallable, Category = "Factory Methods")
 		AMPAbility* SpawnAbility(AActor* abilityOwner, EAbility abilityTag);
 
+	// hand consumed actors back to their factory pool, false means the caller should destroy them
+	UFUNCTION(BlueprintCallable, Category = "Factory Methods")
+		bool ReleaseEnvironment(AMPEnvActorComp* envActor);
+	UFUNCTION(BlueprintCallable, Category = "Factory Methods")
+		bool ReleaseItem(AMPItem* item);
+	UFUNCTION(BlueprintCallable, Category = "Factory Methods")
+		bool ReleaseAbility(AMPAbility* ability);
+	UFUNCTION(BlueprintCallable, Category = "Factory Methods")
+		void DisplayPoolStatus();
+
 	UFUNCTION(BlueprintCallable, Category = "GameProgress Methods")
 		void StartGame();
 
@@ -266,6 +287,8 @@ public :
 	UFUNCTION(BlueprintCallable, Category = "GameProgress Methods")
 		void RegisterPlayerDeath(AMPControllerPlayer* diedPlayer,
 			FVector diedPlayerLocation, FRotator diedPlayerRotation);
+	UFUNCTION(BlueprintCallable, Category = "GameProgress Methods")
+		void RegisterHumanDeath();
 	
 	UFUNCTION(BlueprintCallable, Category = "GameProgress Methods")
 		void DisplayProgressionStatus();
@@ -5,34 +5,288 @@
 #include "../MPActor/Character/MPCharacterHuman.h"
 #include "../MPActor/Item/MPItem.h"
 #include "../MPActor/EnvActor/MPEnvActorComp.h"
+#include "../MPActor/Player/MPControllerPlayer.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 #include "Managers/ManagerLog.h"
+#include "MPSoundEventChannel.h"
+#include "Sound/SoundCue.h"
 
 AMPGS::AMPGS()
 {
-	return;
+	allHumans.Initialize(this, EEntityList::EHuman);
+	allCats.Initialize(this, EEntityList::ECat);
+	allItems.Initialize(this, EEntityList::EItem);
+	allEnvActors.Initialize(this, EEntityList::EEnvActor);
+	lobbyRoster.owner = this;
+}
+
+// entity lists
+void FMPEntityEntry::PreReplicatedRemove(const FMPEntityList& inArraySerializer)
+{
+	// an entry whose actor never resolved was never announced, so there is nothing to remove
+	if (inArraySerializer.owner && hasBroadcastAdd)
+	{
+		inArraySerializer.owner->OnEntityRemoved.Broadcast(inArraySerializer.listType, entityActor);
+	}
+}
+
+void FMPEntityEntry::PostReplicatedAdd(const FMPEntityList& inArraySerializer)
+{
+	BroadcastAddOnceResolved(inArraySerializer);
+}
+
+void FMPEntityEntry::PostReplicatedChange(const FMPEntityList& inArraySerializer)
+{
+	// the fast array calls this when an unmapped entityActor resolves
+	BroadcastAddOnceResolved(inArraySerializer);
+}
+
+void FMPEntityEntry::BroadcastAddOnceResolved(const FMPEntityList& inArraySerializer)
+{
+	if (hasBroadcastAdd || !entityActor || !inArraySerializer.owner) return;
+
+	hasBroadcastAdd = true;
+	inArraySerializer.owner->OnEntityAdded.Broadcast(inArraySerializer.listType, entityActor);
+}
+
+void FMPEntityList::Initialize(AMPGS* inOwner, EEntityList inListType)
+{
+	owner = inOwner;
+	listType = inListType;
+}
+
+void FMPEntityList::AddEntity(AActor* entity)
+{
+	if (!entity || ContainsEntity(entity)) return;
+
+	FMPEntityEntry& newEntry = entries.AddDefaulted_GetRef();
+	newEntry.entityActor = entity;
+	MarkItemDirty(newEntry);
+}
+
+void FMPEntityList::RemoveEntity(AActor* entity)
+{
+	const int32 entryIndex = entries.IndexOfByPredicate([entity](const FMPEntityEntry& entry) { return entry.entityActor == entity; });
+	if (entryIndex == INDEX_NONE) return;
+
+	entries.RemoveAtSwap(entryIndex);
+	MarkArrayDirty();
+}
+
+bool FMPEntityList::ContainsEntity(const AActor* entity) const
+{
+	return entries.ContainsByPredicate([entity](const FMPEntityEntry& entry) { return entry.entityActor == entity; });
+}
+
+// lobby roster
+bool FMPLobbyEntry::IsSameMember(const FMPLobbyEntry& other) const
+{
+	if (isBot != other.isBot) return false;
+	return isBot ? botController == other.botController : playerState == other.playerState;
+}
+
+bool FMPLobbyEntry::HasSameData(const FMPLobbyEntry& other) const
+{
+	return playerName == other.playerName && team == other.team && isReady == other.isReady && playerIndex == other.playerIndex;
+}
+
+void FMPLobbyEntry::PreReplicatedRemove(const FMPLobbyRoster& inArraySerializer)
+{
+	if (inArraySerializer.owner)
+	{
+		inArraySerializer.owner->OnLobbyEvent.Broadcast(isBot ? ELobbyEvent::EBotRemoved : ELobbyEvent::EPlayerLeft, *this);
+	}
+}
+
+void FMPLobbyEntry::PostReplicatedAdd(const FMPLobbyRoster& inArraySerializer)
+{
+	lastTeam = team;
+	lastIsReady = isReady;
+
+	if (inArraySerializer.owner)
+	{
+		inArraySerializer.owner->OnLobbyEvent.Broadcast(isBot ? ELobbyEvent::EBotAdded : ELobbyEvent::EPlayerJoined, *this);
+	}
+}
+
+void FMPLobbyEntry::PostReplicatedChange(const FMPLobbyRoster& inArraySerializer)
+{
+	// a team switch resets ready, it is still reported as one switch
+	const ELobbyEvent lobbyEvent = team != lastTeam ? ELobbyEvent::ESwitchedTeam
+		: isReady != lastIsReady ? ELobbyEvent::EReadyChanged
+		: ELobbyEvent::EUpdated;
+	lastTeam = team;
+	lastIsReady = isReady;
+
+	if (inArraySerializer.owner)
+	{
+		inArraySerializer.owner->OnLobbyEvent.Broadcast(lobbyEvent, *this);
+	}
+}
+
+bool FMPLobbyRoster::Sync(const TArray<FMPLobbyEntry>& desiredEntries)
+{
+	bool hasChanged = false;
+
+	// players who left and removed bots; RemoveAt keeps the join order for the next sync
+	for (int32 index = entries.Num() - 1; index >= 0; --index)
+	{
+		FMPLobbyEntry& entry = entries[index];
+		if (desiredEntries.ContainsByPredicate([&entry](const FMPLobbyEntry& desiredEntry) { return desiredEntry.IsSameMember(entry); })) continue;
+
+		entry.PreReplicatedRemove(*this);
+		entries.RemoveAt(index);
+		MarkArrayDirty();
+		hasChanged = true;
+	}
+
+	// the server raises the same events a client will, through the same callbacks
+	for (const FMPLobbyEntry& desiredEntry : desiredEntries)
+	{
+		FMPLobbyEntry* entry = entries.FindByPredicate([&desiredEntry](const FMPLobbyEntry& eachEntry) { return eachEntry.IsSameMember(desiredEntry); });
+		if (!entry)
+		{
+			FMPLobbyEntry& newEntry = entries.Add_GetRef(desiredEntry);
+			newEntry.lobbyId = nextLobbyId++;
+			MarkItemDirty(newEntry);
+			newEntry.PostReplicatedAdd(*this);
+			hasChanged = true;
+		}
+		else if (!entry->HasSameData(desiredEntry))
+		{
+			entry->playerName = desiredEntry.playerName;
+			entry->team = desiredEntry.team;
+			entry->isReady = desiredEntry.isReady;
+			entry->playerIndex = desiredEntry.playerIndex;
+			MarkItemDirty(*entry);
+			entry->PostReplicatedChange(*this);
+			hasChanged = true;
+		}
+	}
+	return hasChanged;
+}
+
+void AMPGS::SyncLobbyRoster(const TArray<FMPLobbyEntry>& desiredEntries)
+{
+	if (!HasAuthority()) return;
+
+	if (lobbyRoster.Sync(desiredEntries))
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, lobbyRoster, this);
+	}
+}
+
+TArray<AMPCharacterHuman*> AMPGS::GetAllHumans() const
+{
+	return allHumans.GetEntities<AMPCharacterHuman>();
+}
+
+TArray<AMPCharacterCat*> AMPGS::GetAllCats() const
+{
+	return allCats.GetEntities<AMPCharacterCat>();
+}
+
+TArray<AMPItem*> AMPGS::GetAllItems() const
+{
+	return allItems.GetEntities<AMPItem>();
+}
+
+TArray<AMPEnvActorComp*> AMPGS::GetAllEnvActors() const
+{
+	return allEnvActors.GetEntities<AMPEnvActorComp>();
+}
+
+void AMPGS::AddEntity(EEntityList listType, AActor* entity)
+{
+	if (!HasAuthority()) return;
+
+	FMPEntityList* entityList = GetEntityList(listType);
+	if (entityList && !entityList->ContainsEntity(entity))
+	{
+		entityList->AddEntity(entity);
+		MarkEntityListDirty(listType);
+		OnEntityAdded.Broadcast(listType, entity);
+	}
+}
+
+void AMPGS::RemoveEntity(EEntityList listType, AActor* entity)
+{
+	if (!HasAuthority()) return;
+
+	FMPEntityList* entityList = GetEntityList(listType);
+	if (entityList && entityList->ContainsEntity(entity))
+	{
+		OnEntityRemoved.Broadcast(listType, entity);
+		entityList->RemoveEntity(entity);
+		MarkEntityListDirty(listType);
+	}
+}
+
+void AMPGS::MarkEntityListDirty(EEntityList listType)
+{
+	switch (listType)
+	{
+	case EEntityList::EHuman:
+		MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, allHumans, this);
+		break;
+	case EEntityList::ECat:
+		MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, allCats, this);
+		break;
+	case EEntityList::EItem:
+		MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, allItems, this);
+		break;
+	case EEntityList::EEnvActor:
+		MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, allEnvActors, this);
+		break;
+	default:
+		break;
+	}
+}
+
+FMPEntityList* AMPGS::GetEntityList(EEntityList listType)
+{
+	switch (listType)
+	{
+	case EEntityList::EHuman:
+		return &allHumans;
+	case EEntityList::ECat:
+		return &allCats;
+	case EEntityList::EItem:
+		return &allItems;
+	case EEntityList::EEnvActor:
+		return &allEnvActors;
+	default:
+		return nullptr;
+	}
 }
 
 void AMPGS::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(AMPGS, allHumans);
-	DOREPLIFETIME(AMPGS, allCats);
-	DOREPLIFETIME(AMPGS, allItems);
-	DOREPLIFETIME(AMPGS, allEnvActors);
-
-	DOREPLIFETIME(AMPGS, isMostPlayerReady);
-
-	DOREPLIFETIME(AMPGS, curReadyTime);
-	DOREPLIFETIME(AMPGS, curPrepareTime);
-	DOREPLIFETIME(AMPGS, curGameplayTime);
-	DOREPLIFETIME(AMPGS, totalMPProgression);
-	DOREPLIFETIME(AMPGS, curMPProgression);
-	DOREPLIFETIME(AMPGS, curMPProgressionPercentage);
-	DOREPLIFETIME(AMPGS, totalCatPlayers);
-	DOREPLIFETIME(AMPGS, caughtCats);
-	DOREPLIFETIME(AMPGS, caughtCatsPercentage);
+	// push model: properties are only compared after their setter marked them dirty
+	FDoRepLifetimeParams pushParams;
+	pushParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, allHumans, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, allCats, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, allItems, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, allEnvActors, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, soundEventTable, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, lobbyRoster, pushParams);
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, isMostPlayerReady, pushParams);
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, phaseClock, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, totalMPProgression, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, curMPProgression, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, curMPProgressionPercentage, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, totalCatPlayers, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, caughtCats, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPGS, caughtCatsPercentage, pushParams);
 	
 }
 
@@ -41,6 +295,113 @@ void AMPGS::BeginPlay()
 	Super::BeginPlay();
 }
 
+// sound event table
+uint16 AMPGS::FindOrAddSoundEventId(USoundCue* sound)
+{
+	if (!sound) return InvalidSoundEventId;
+
+	if (const uint16* existingId = soundEventIds.Find(sound)) return *existingId;
+
+	if (soundEventTable.Num() >= InvalidSoundEventId)
+	{
+		MP_LOG_WARNING(TEXT("AMPGS"), TEXT("Sound event table is full, %s is not broadcast"), *sound->GetName());
+		return InvalidSoundEventId;
+	}
+
+	const uint16 newId = static_cast<uint16>(soundEventTable.Add(sound));
+	soundEventIds.Add(sound, newId);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, soundEventTable, this);
+	return newId;
+}
+
+uint16 AMPGS::FindSoundEventId(USoundCue* sound) const
+{
+	const uint16* existingId = sound ? soundEventIds.Find(sound) : nullptr;
+	return existingId ? *existingId : InvalidSoundEventId;
+}
+
+USoundCue* AMPGS::GetSoundEventSound(uint16 soundId) const
+{
+	return soundEventTable.IsValidIndex(soundId) ? soundEventTable[soundId] : nullptr;
+}
+
+void AMPGS::OnRep_SoundEventTable()
+{
+	if (UMPSoundEventChannel* channel = GetWorld() ? GetWorld()->GetSubsystem<UMPSoundEventChannel>() : nullptr)
+	{
+		channel->ResolveUnknownSoundEvents();
+	}
+}
+
+// phase clock
+void AMPGS::SetPhaseClock(EGPStatus phase, int32 durationSeconds)
+{
+	phaseClock.phase = phase;
+	phaseClock.phaseEndServerTime = GetServerWorldTimeSeconds() + durationSeconds;
+	phaseClock.isRunning = true;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, phaseClock, this);
+
+	// OnRep is not called on the server, the listen host needs its own display too
+	OnRep_PhaseClock();
+}
+
+void AMPGS::StopPhaseClock()
+{
+	phaseClock.isRunning = false;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, phaseClock, this);
+	OnRep_PhaseClock();
+}
+
+float AMPGS::GetPhaseRemainingTime() const
+{
+	if (!phaseClock.isRunning)
+	{
+		return 0.0f;
+	}
+	return FMath::Max(phaseClock.phaseEndServerTime - GetServerWorldTimeSeconds(), 0.0f);
+}
+
+int32 AMPGS::GetPhaseRemainingSeconds() const
+{
+	return FMath::CeilToInt(GetPhaseRemainingTime());
+}
+
+void AMPGS::OnRep_PhaseClock()
+{
+	UWorld* world = GetWorld();
+	if (!world) return;
+
+	world->GetTimerManager().ClearTimer(localCountdownTimerHandle);
+	if (phaseClock.isRunning)
+	{
+		RefreshLocalCountdown();
+		world->GetTimerManager().SetTimer(localCountdownTimerHandle, this, &AMPGS::RefreshLocalCountdown, 1.0f, true);
+	}
+}
+
+void AMPGS::RefreshLocalCountdown()
+{
+	const int32 secondsRemaining = GetPhaseRemainingSeconds();
+
+	// only the lobby HUD shows a pushed countdown, gameplay HUDs read GetPhaseRemainingSeconds directly
+	if (phaseClock.phase == EGPStatus::ELobby || phaseClock.phase == EGPStatus::ECustomCharacter)
+	{
+		for (FConstPlayerControllerIterator it = GetWorld()->GetPlayerControllerIterator(); it; ++it)
+		{
+			AMPControllerPlayer* localPlayer = Cast<AMPControllerPlayer>(it->Get());
+			if (localPlayer && localPlayer->IsLocalController())
+			{
+				localPlayer->UpdateLobbyHUDCountdownText(secondsRemaining);
+			}
+		}
+	}
+
+	if (secondsRemaining <= 0)
+	{
+		GetWorld()->GetTimerManager().ClearTimer(localCountdownTimerHandle);
+	}
+}
+
 void AMPGS::UpdateMPProgression(int modifier)
 {
 	// Don't update if game has ended
@@ -63,6 +424,9 @@ void AMPGS::UpdateMPProgression(int modifier)
 	{
 		curMPProgressionPercentage = 0.0f;
 	}
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, curMPProgression, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, curMPProgressionPercentage, this);
 }
 
 void AMPGS::UpdateHumanProgression(int modifier)
@@ -87,24 +451,77 @@ void AMPGS::UpdateHumanProgression(int modifier)
 	{
 		caughtCatsPercentage = 0.0f;
 	}
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, caughtCats, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, caughtCatsPercentage, this);
+}
+
+void AMPGS::SetMostPlayerReady(bool newMostPlayerReady)
+{
+	if (isMostPlayerReady == newMostPlayerReady) return;
+
+	isMostPlayerReady = newMostPlayerReady;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, isMostPlayerReady, this);
+}
+
+void AMPGS::ResetMPProgression(float newTotalMPProgression)
+{
+	totalMPProgression = newTotalMPProgression;
+	curMPProgression = 0.0f;
+	curMPProgressionPercentage = 0.0f;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, totalMPProgression, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, curMPProgression, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, curMPProgressionPercentage, this);
+}
+
+void AMPGS::ResetHumanProgression(int32 newTotalCatPlayers)
+{
+	totalCatPlayers = newTotalCatPlayers;
+	caughtCats = 0;
+	caughtCatsPercentage = 0.0f;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, totalCatPlayers, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, caughtCats, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, caughtCatsPercentage, this);
+}
+
+void AMPGS::RemoveCatPlayer()
+{
+	if (totalCatPlayers <= 0) return;
+
+	totalCatPlayers--;
+
+	// Recalculate percentage
+	if (totalCatPlayers > 0)
+	{
+		caughtCatsPercentage = (float)caughtCats / (float)totalCatPlayers;
+	}
+	else
+	{
+		caughtCatsPercentage = 1.0f; // All cats disconnected, human team wins
+	}
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, totalCatPlayers, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPGS, caughtCatsPercentage, this);
 }
 
 void AMPGS::OnRep_CurMPProgression()
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Client: Progression Updated to %f"), curMPProgression), TEXT("MPGS"));
+	MP_LOG_INFO(TEXT("MPGS"), TEXT("Client: Progression Updated to %f"), curMPProgression);
 }
 
 void AMPGS::OnRep_CurMPProgressionPercentage()
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Client: Progression Percentage Updated to %.1f%%"), curMPProgressionPercentage * 100.0f), TEXT("MPGS"));
+	MP_LOG_INFO(TEXT("MPGS"), TEXT("Client: Progression Percentage Updated to %.1f%%"), curMPProgressionPercentage * 100.0f);
 }
 
 void AMPGS::OnRep_CaughtCats()
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Client: Caught Cats Updated to %d"), caughtCats), TEXT("MPGS"));
+	MP_LOG_INFO(TEXT("MPGS"), TEXT("Client: Caught Cats Updated to %d"), caughtCats);
 }
 
 void AMPGS::OnRep_CaughtCatsPercentage()
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Client: Caught Cats Percentage Updated to %.1f%%"), caughtCatsPercentage * 100.0f), TEXT("MPGS"));
+	MP_LOG_INFO(TEXT("MPGS"), TEXT("Client: Caught Cats Percentage Updated to %.1f%%"), caughtCatsPercentage * 100.0f);
 }
\ No newline at end of file
@@ -10,7 +10,7 @@
 // How to utilize in Blueprint:
 // 1. From any Blueprint, you can get a reference to the Game State using the "Get Game State" node and casting it to `BP_MPGS`. This is a safe and common operation on clients.
 // 2. UI elements (like the main game HUD) are the primary consumers of this class. They bind to the replicated variables to display up-to-date information. For example:
-//    - A timer on the HUD would display the value of `curGameplayTime`.
+//    - A timer on the HUD would display `GetPhaseRemainingSeconds()`, which counts down locally from the replicated `phaseClock` deadline.
 //    - A progress bar for the Cat team would use `curMPProgressionPercentage`.
 //    - A progress bar for the Human team would use `caughtCatsPercentage`.
 // 3. Since this data is replicated, clients do not need to ask the server for it via RPCs. They can simply read the properties from their local copy of the Game State.
@@ -24,17 +24,170 @@
 // - AMPGMGameplay (Game Mode): The Game Mode is the "owner" and "writer" of the Game State. On the server, the Game Mode calculates game progress and timers and updates the properties on the Game State. The engine's networking system then automatically replicates these changes to all clients.
 // - OnRep_... functions: These are RepNotify functions. When a client receives an update for a variable marked with `ReplicatedUsing`, the corresponding `OnRep_` function is automatically called. This is extremely useful for triggering UI updates or sound effects on the client precisely when the data changes. For example, `OnRep_CurMPProgression` could trigger a sound effect indicating progress was made.
 // - HUDs: The UI reads data from the Game State to display the status of the match to the player.
+// - UMPWorldRegistry: On the server, every human, cat, item and env actor that registers or unregisters is added to or removed from the matching entity list here (`allHumans`, `allCats`, `allItems`, `allEnvActors`).
+//   These lists are fast arrays, so one add or remove only sends that entry. Clients get `OnEntityAdded` / `OnEntityRemoved` per entry instead of a new copy of the whole array. `OnEntityAdded` waits until the entry's actor has resolved on the client, so listeners never get a null actor.
+// - UManagerLobby: `SyncLobbyRoster` diffs the lobby players and bots against `lobbyRoster`, another fast array. Only the entries that joined, left or changed are sent.
+//   Every machine, the server included, raises one typed `OnLobbyEvent` per entry (joined, left, switched team, ready changed, bot added or removed). `UHUDLobby` patches its lists from these events.
+// - Push model: Every replicated property here is push-based. It is only sent after its setter (`SetMostPlayerReady`, `ResetMPProgression`, `UpdateMPProgression`, `UpdateHumanProgression`, ...) marks it dirty, so nothing else should write these properties directly.
+// - UManagerMatchClock: Writes `phaseClock` once per phase. The `cur...Time` counters are server-side mirrors and are not replicated; each machine refreshes its own lobby countdown text from a local timer.
+// - UMPSoundEventChannel: `soundEventTable` maps the 16 bit ids of broadcast sound events to sound cues. The server appends a cue the first time it is broadcast, so every later event carries only its id.
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameStateBase.h"
+#include "Engine/NetSerialization.h"
+#include "../CommonStruct.h"
 #include "MPGS.generated.h"
 
 class AMPCharacterHuman;
 class AMPCharacterCat;
 class AMPItem;
 class AMPEnvActorComp;
+class AMPGS;
+class AMPPlayerState;
+class AMPAIController;
+class USoundCue;
+struct FMPEntityList;
+struct FMPLobbyRoster;
 
-enum class EGPStatus : uint8;
+// one replicated entry of an entity list
+USTRUCT()
+struct FMPEntityEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+		AActor* entityActor = nullptr;
+
+	// client only, the add is held back until entityActor resolves, which can be after the entry arrives
+	bool hasBroadcastAdd = false;
+
+	void PreReplicatedRemove(const FMPEntityList& inArraySerializer);
+	void PostReplicatedAdd(const FMPEntityList& inArraySerializer);
+	void PostReplicatedChange(const FMPEntityList& inArraySerializer);
+
+private:
+	void BroadcastAddOnceResolved(const FMPEntityList& inArraySerializer);
+};
+
+// fast array of the humans, cats, items or env actors of the match, only written by the server
+USTRUCT()
+struct FMPEntityList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+		TArray<FMPEntityEntry> entries;
+
+	UPROPERTY(NotReplicated)
+		AMPGS* owner = nullptr;
+
+	EEntityList listType = EEntityList::EHuman;
+
+	void Initialize(AMPGS* inOwner, EEntityList inListType);
+	void AddEntity(AActor* entity);
+	void RemoveEntity(AActor* entity);
+	bool ContainsEntity(const AActor* entity) const;
+	int32 Num() const { return entries.Num(); }
+
+	template<typename T>
+	TArray<T*> GetEntities() const
+	{
+		TArray<T*> result;
+		result.Reserve(entries.Num());
+		for (const FMPEntityEntry& entry : entries)
+		{
+			if (T* entity = Cast<T>(entry.entityActor))
+			{
+				result.Add(entity);
+			}
+		}
+		return result;
+	}
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& deltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FMPEntityEntry, FMPEntityList>(entries, deltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FMPEntityList> : public TStructOpsTypeTraitsBase2<FMPEntityList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+// one player or bot in the lobby
+USTRUCT()
+struct FMPLobbyEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	// handed out by the server in join order, the key clients track an entry by
+	UPROPERTY()
+		int32 lobbyId = INDEX_NONE;
+	UPROPERTY()
+		FString playerName;
+	UPROPERTY()
+		ETeam team = ETeam::ENone;
+	UPROPERTY()
+		bool isReady = false;
+	UPROPERTY()
+		bool isBot = false;
+	// player index for players, index in the combined bot list for bots
+	UPROPERTY()
+		int32 playerIndex = INDEX_NONE;
+	UPROPERTY()
+		AMPPlayerState* playerState = nullptr;
+	// server only, AI controllers do not exist on clients
+	UPROPERTY(NotReplicated)
+		AMPAIController* botController = nullptr;
+
+	// values of the last event raised for this entry, a change is told apart by them
+	ETeam lastTeam = ETeam::ENone;
+	bool lastIsReady = false;
+
+	bool IsSameMember(const FMPLobbyEntry& other) const;
+	bool HasSameData(const FMPLobbyEntry& other) const;
+
+	void PreReplicatedRemove(const FMPLobbyRoster& inArraySerializer);
+	void PostReplicatedAdd(const FMPLobbyRoster& inArraySerializer);
+	void PostReplicatedChange(const FMPLobbyRoster& inArraySerializer);
+};
+
+// fast array of the lobby players and bots, only written by the server
+USTRUCT()
+struct FMPLobbyRoster : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+		TArray<FMPLobbyEntry> entries;
+
+	UPROPERTY(NotReplicated)
+		AMPGS* owner = nullptr;
+
+	int32 nextLobbyId = 0;
+
+	// adds, removes and updates entries so the roster matches desiredEntries; false when nothing changed
+	bool Sync(const TArray<FMPLobbyEntry>& desiredEntries);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& deltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FMPLobbyEntry, FMPLobbyRoster>(entries, deltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FMPLobbyRoster> : public TStructOpsTypeTraitsBase2<FMPLobbyRoster>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
 
 /* Some thoughts
 The reason why GameState should hold all attributes related with the game
@@ -53,52 +206,131 @@ public:
 
 // common GS properties
 public:
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "Common Properties")
-		TArray<AMPCharacterHuman*> allHumans;
+	UPROPERTY(Replicated)
+		FMPEntityList allHumans;
 
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "Common Properties")
-		TArray<AMPCharacterCat*> allCats;
+	UPROPERTY(Replicated)
+		FMPEntityList allCats;
 	
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "Common Properties")
-		TArray<AMPItem*> allItems;
+	UPROPERTY(Replicated)
+		FMPEntityList allItems;
 	
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "Common Properties")
-		TArray<AMPEnvActorComp*> allEnvActors;
+	UPROPERTY(Replicated)
+		FMPEntityList allEnvActors;
+
+	UFUNCTION(BlueprintCallable, Category = "Common Methods")
+		TArray<AMPCharacterHuman*> GetAllHumans() const;
+	UFUNCTION(BlueprintCallable, Category = "Common Methods")
+		TArray<AMPCharacterCat*> GetAllCats() const;
+	UFUNCTION(BlueprintCallable, Category = "Common Methods")
+		TArray<AMPItem*> GetAllItems() const;
+	UFUNCTION(BlueprintCallable, Category = "Common Methods")
+		TArray<AMPEnvActorComp*> GetAllEnvActors() const;
+
+	// server only, called by UMPWorldRegistry
+	void AddEntity(EEntityList listType, AActor* entity);
+	void RemoveEntity(EEntityList listType, AActor* entity);
+
+	// fired on clients for every replicated entry (and on the server when it edits a list)
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnEntityListChanged, EEntityList, AActor*);
+	FOnEntityListChanged OnEntityAdded;
+	FOnEntityListChanged OnEntityRemoved;
+
+protected:
+	FMPEntityList* GetEntityList(EEntityList listType);
+	void MarkEntityListDirty(EEntityList listType);
+
+// lobby roster
+public:
+	UPROPERTY(Replicated)
+		FMPLobbyRoster lobbyRoster;
+
+	// server only, called by UManagerLobby with every player and bot currently in the lobby
+	void SyncLobbyRoster(const TArray<FMPLobbyEntry>& desiredEntries);
+
+	// fired on clients for every replicated entry, and on the server when it edits the roster
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnLobbyEvent, ELobbyEvent, const FMPLobbyEntry&);
+	FOnLobbyEvent OnLobbyEvent;
+
+// sound event table
+public:
+	static constexpr uint16 InvalidSoundEventId = MAX_uint16;
+
+	// server only, ids are indices into soundEventTable and never change during the match
+	uint16 FindOrAddSoundEventId(USoundCue* sound);
+	// InvalidSoundEventId when the sound was never broadcast
+	uint16 FindSoundEventId(USoundCue* sound) const;
+	USoundCue* GetSoundEventSound(uint16 soundId) const;
+
+	UFUNCTION()
+		void OnRep_SoundEventTable();
+
+protected:
+	// only ever appended, so a client can resolve any id it has received
+	UPROPERTY(ReplicatedUsing = OnRep_SoundEventTable)
+		TArray<USoundCue*> soundEventTable;
+
+	TMap<USoundCue*, uint16> soundEventIds;
+
+public:
 
 	// Gameplay progression
 	UPROPERTY(BlueprintReadWrite, Category = "GameProgress Properties")
 		EGPStatus curGameplayStatus;
 	
 		// lobby
-	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = "GameProgress Properties")
+	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = "GameProgress Properties")
 		bool isMostPlayerReady = false;
 
+	void SetMostPlayerReady(bool newMostPlayerReady);
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameProgress Properties")
 		int readyTotalTime;
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "GameProgress Properties")
+	UPROPERTY(BlueprintReadWrite, Category = "GameProgress Properties")
 		int curReadyTime;
 	
 		// custom character
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameProgress Properties")
 		int customCharacterTotalTime;
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "GameProgress Properties")
+	UPROPERTY(BlueprintReadWrite, Category = "GameProgress Properties")
 		int curCustomCharacterTime;
 
 		// gameplay -> MP Progression
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameProgress Properties")
 		int prepareTotalTime;
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "GameProgress Properties")
+	UPROPERTY(BlueprintReadWrite, Category = "GameProgress Properties")
 		int curPrepareTime;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameProgress Properties")
 		int gameplayTotalTime;
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "GameProgress Properties")
+	UPROPERTY(BlueprintReadWrite, Category = "GameProgress Properties")
 		int curGameplayTime;
 
-		UPROPERTY(Replicated, BlueprintReadWrite, Category = "Common Properties")
+		// phase clock, the only timing data sent to clients
+	UPROPERTY(ReplicatedUsing = OnRep_PhaseClock, BlueprintReadOnly, Category = "GameProgress Properties")
+		FMatchPhaseClock phaseClock;
+
+protected:
+	FTimerHandle localCountdownTimerHandle;
+
+	void RefreshLocalCountdown();
+
+public:
+	void SetPhaseClock(EGPStatus phase, int32 durationSeconds);
+	void StopPhaseClock();
+
+	UFUNCTION(BlueprintCallable, Category = "GameProgress Methods")
+		float GetPhaseRemainingTime() const;
+	UFUNCTION(BlueprintCallable, Category = "GameProgress Methods")
+		int32 GetPhaseRemainingSeconds() const;
+
+	UFUNCTION()
+		void OnRep_PhaseClock();
+
+		UPROPERTY(Replicated, BlueprintReadOnly, Category = "Common Properties")
 		float totalMPProgression;
-	UPROPERTY(ReplicatedUsing = OnRep_CurMPProgression, BlueprintReadWrite, Category = "Common Properties")
+	UPROPERTY(ReplicatedUsing = OnRep_CurMPProgression, BlueprintReadOnly, Category = "Common Properties")
 		float curMPProgression;
-	UPROPERTY(ReplicatedUsing = OnRep_CurMPProgressionPercentage, BlueprintReadWrite, Category = "Common Properties")
+	UPROPERTY(ReplicatedUsing = OnRep_CurMPProgressionPercentage, BlueprintReadOnly, Category = "Common Properties")
 		float curMPProgressionPercentage;
 
 	// Cat team objective: percentage of total progression needed to win (default 80%)
@@ -106,11 +338,11 @@ public:
 		float catWinProgressionPercentage = 0.8f; // 80% default
 
 	// Human team progression (cat catching)
-	UPROPERTY(Replicated, BlueprintReadWrite, Category = "Common Properties")
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Common Properties")
 		int32 totalCatPlayers = 0;
-	UPROPERTY(ReplicatedUsing = OnRep_CaughtCats, BlueprintReadWrite, Category = "Common Properties")
+	UPROPERTY(ReplicatedUsing = OnRep_CaughtCats, BlueprintReadOnly, Category = "Common Properties")
 		int32 caughtCats = 0;
-	UPROPERTY(ReplicatedUsing = OnRep_CaughtCatsPercentage, BlueprintReadWrite, Category = "Common Properties")
+	UPROPERTY(ReplicatedUsing = OnRep_CaughtCatsPercentage, BlueprintReadOnly, Category = "Common Properties")
 		float caughtCatsPercentage = 0.0f;
 
 	UFUNCTION(BlueprintCallable, Category = "Common Methods")
@@ -120,6 +352,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Common Methods")
 		void UpdateHumanProgression(int modifier);
 
+	// server only, start-of-match resets and the cat-left case
+	void ResetMPProgression(float newTotalMPProgression);
+	void ResetHumanProgression(int32 newTotalCatPlayers);
+	void RemoveCatPlayer();
+
 	UFUNCTION()
 		void OnRep_CurMPProgression();
 	UFUNCTION()
@@ -0,0 +1,106 @@
+#include "MPNoiseAggregator.h"
+
+#include "Engine/World.h"
+#include "Perception/AISense_Hearing.h"
+
+#include "MPGMGameplay.h"
+#include "Managers/ManagerAIController.h"
+
+DECLARE_STATS_GROUP(TEXT("MPNoise"), STATGROUP_MPNoise, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Noises Reported"), STAT_MPNoiseReported, STATGROUP_MPNoise);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Clusters Flushed"), STAT_MPNoiseClustersFlushed, STATGROUP_MPNoise);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Search Tasks"), STAT_MPNoiseSearchTasks, STATGROUP_MPNoise);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Open Clusters"), STAT_MPNoiseOpenClusters, STATGROUP_MPNoise);
+
+void UMPNoiseAggregator::Deinitialize()
+{
+	openClusters.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UMPNoiseAggregator::IsTickable() const
+{
+	return Super::IsTickable() && openClusters.Num() > 0;
+}
+
+TStatId UMPNoiseAggregator::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMPNoiseAggregator, STATGROUP_Tickables);
+}
+
+void UMPNoiseAggregator::Tick(float deltaTime)
+{
+	Super::Tick(deltaTime);
+
+	const double flushBefore = GetWorld()->GetTimeSeconds() - clusterWindowSeconds;
+
+	// clusters are in opening order, so the ones due are at the front
+	int32 numDue = 0;
+	while (numDue < openClusters.Num() && openClusters[numDue].openTime <= flushBefore) ++numDue;
+	if (numDue == 0) return;
+
+	for (int32 index = 0; index < numDue; ++index)
+	{
+		FlushCluster(openClusters[index]);
+	}
+	openClusters.RemoveAt(0, numDue, false);
+
+	SET_DWORD_STAT(STAT_MPNoiseOpenClusters, openClusters.Num());
+}
+
+void UMPNoiseAggregator::ReportNoise(const FVector& location, float loudness, AActor* instigator, FName tag)
+{
+	UWorld* world = GetWorld();
+	if (!world || world->GetNetMode() == NM_Client) return;
+
+	INC_DWORD_STAT(STAT_MPNoiseReported);
+	loudness = FMath::Max(loudness, KINDA_SMALL_NUMBER);
+
+	const float clusterRadiusSquared = clusterRadius * clusterRadius;
+	FNoiseCluster* cluster = nullptr;
+	for (FNoiseCluster& eachCluster : openClusters)
+	{
+		if (eachCluster.tag == tag && FVector::DistSquared(eachCluster.GetCentre(), location) <= clusterRadiusSquared)
+		{
+			cluster = &eachCluster;
+			break;
+		}
+	}
+
+	if (!cluster)
+	{
+		cluster = &openClusters.AddDefaulted_GetRef();
+		cluster->tag = tag;
+		cluster->openTime = world->GetTimeSeconds();
+	}
+
+	cluster->weightedLocationSum += location * loudness;
+	cluster->totalLoudness += loudness;
+	++cluster->noiseCount;
+	if (loudness >= cluster->maxLoudness)
+	{
+		cluster->maxLoudness = loudness;
+		cluster->loudestInstigator = instigator;
+	}
+}
+
+void UMPNoiseAggregator::FlushCluster(const FNoiseCluster& cluster)
+{
+	UWorld* world = GetWorld();
+	const FVector centre = cluster.GetCentre();
+
+	// many noises in one spot carry further than the loudest of them alone, up to the cap
+	const float clusterLoudness = FMath::Clamp(cluster.totalLoudness, cluster.maxLoudness, FMath::Max(maxClusterLoudness, cluster.maxLoudness));
+	UAISense_Hearing::ReportNoiseEvent(world, centre, clusterLoudness, cluster.loudestInstigator.Get(), 0.0f, cluster.tag);
+	INC_DWORD_STAT(STAT_MPNoiseClustersFlushed);
+
+	if (cluster.totalLoudness < globalSearchWeight) return;
+
+	AMPGMGameplay* gameMode = world->GetAuthGameMode<AMPGMGameplay>();
+	if (UManagerAIController* managerAIController = gameMode ? gameMode->GetManagerAIController() : nullptr)
+	{
+		managerAIController->AddGlobalSearchTask(centre, cluster.totalLoudness);
+		INC_DWORD_STAT(STAT_MPNoiseSearchTasks);
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This world subsystem sits between gameplay noises and AI hearing on the server. Noises are not
+// reported to the hearing sense one by one. Instead, each noise joins an open cluster of the same tag
+// within `clusterRadius`, or opens a new one. `clusterWindowSeconds` after a cluster opens, it is
+// flushed as a single hearing event at the loudness-weighted centre of its noises:
+// - Hearing listeners get one stimulus per cluster instead of a burst, so a bot's perception update and its Behavior Tree re-evaluation run once.
+// - A cluster whose total loudness reaches `globalSearchWeight` also becomes one weighted search task on `UManagerAIController`.
+//
+// How to utilize in Blueprint:
+// - It is not exposed to Blueprint. Call `USoundEventUtility::ReportAIGameplayNoise`, which forwards here.
+//
+// Necessary things to define:
+// - Optional tuning in DefaultGame.ini under `[/Script/MeowPhone.MPNoiseAggregator]`: `clusterRadius`, `clusterWindowSeconds`, `globalSearchWeight`, `maxClusterLoudness`.
+//
+// How it interacts with other classes:
+// - USoundEventUtility: `ReportAIGameplayNoise` calls `ReportNoise`. The utility reports the noise directly only when there is no aggregator.
+// - UAISense_Hearing: Receives one `ReportNoiseEvent` per flushed cluster, carrying the instigator of its loudest noise.
+// - UManagerAIController: `AddGlobalSearchTask` receives the cluster centre and its weight.
+// - `stat MPNoise`: Noises reported and clusters flushed, and so how many noises clustering saved.
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MPNoiseAggregator.generated.h"
+
+UCLASS(Config = Game)
+class UMPNoiseAggregator : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float deltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	// server only, a client never hears AI noises
+	void ReportNoise(const FVector& location, float loudness, AActor* instigator, FName tag);
+
+// config
+protected:
+	UPROPERTY(Config)
+		float clusterRadius = 600.0f;
+	UPROPERTY(Config)
+		float clusterWindowSeconds = 0.3f;
+	// total loudness of a cluster before it also sends a bot to search
+	UPROPERTY(Config)
+		float globalSearchWeight = 3.0f;
+	// the hearing event grows with the number of noises but never beyond this
+	UPROPERTY(Config)
+		float maxClusterLoudness = 2.0f;
+
+// clusters
+protected:
+	struct FNoiseCluster
+	{
+		FName tag;
+		FVector weightedLocationSum = FVector::ZeroVector;
+		float totalLoudness = 0.0f;
+		float maxLoudness = 0.0f;
+		int32 noiseCount = 0;
+		double openTime = 0.0;
+		TWeakObjectPtr<AActor> loudestInstigator;
+
+		FVector GetCentre() const { return totalLoudness > 0.0f ? weightedLocationSum / totalLoudness : weightedLocationSum; }
+	};
+
+	TArray<FNoiseCluster> openClusters;
+
+	void FlushCluster(const FNoiseCluster& cluster);
+};
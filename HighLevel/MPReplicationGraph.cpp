@@ -0,0 +1,481 @@
+#include "MPReplicationGraph.h"
+
+#include "Engine/World.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "UObject/UObjectIterator.h"
+
+#include "MPGMGameplay.h"
+#include "MPWorldRegistry.h"
+#include "Managers/ManagerLog.h"
+
+#include "../CommonEnum.h"
+#include "../MPActor/Character/MPCharacter.h"
+#include "../MPActor/Item/MPItem.h"
+#include "../MPActor/Ability/MPAbility.h"
+#include "../MPActor/EnvActor/MPEnvActorComp.h"
+#include "../MPActor/EnvActor/MPEnvActorCompFracture.h"
+
+void UMPReplicationGraph::RegisterReplicationDriver()
+{
+	UReplicationDriver::CreateReplicationDriverDelegate().BindLambda([](UNetDriver* forNetDriver, const FURL& url, UWorld* world) -> UReplicationDriver*
+	{
+		if (!forNetDriver || forNetDriver->NetDriverName != NAME_GameNetDriver) return nullptr;
+		if (FParse::Param(FCommandLine::Get(), TEXT("NoMPRepGraph"))) return nullptr;
+
+		return NewObject<UMPReplicationGraph>(GetTransientPackage());
+	});
+}
+
+UMPReplicationGraph* UMPReplicationGraph::Get(const UWorld* world)
+{
+	UNetDriver* netDriver = world ? world->GetNetDriver() : nullptr;
+	return netDriver ? Cast<UMPReplicationGraph>(netDriver->GetReplicationDriver()) : nullptr;
+}
+
+// class settings
+EMPClassRepNodeMapping UMPReplicationGraph::GetDefaultMappingPolicy(UClass* actorClass) const
+{
+	const AActor* actorCDO = actorClass ? Cast<AActor>(actorClass->GetDefaultObject()) : nullptr;
+	if (!actorCDO || !actorCDO->GetIsReplicated()) return EMPClassRepNodeMapping::NotRouted;
+
+	if (actorCDO->bAlwaysRelevant || actorClass->IsChildOf(AGameStateBase::StaticClass()) || actorClass->IsChildOf(APlayerState::StaticClass()))
+	{
+		return EMPClassRepNodeMapping::RelevantAllConnections;
+	}
+	if (actorCDO->bOnlyRelevantToOwner)
+	{
+		return EMPClassRepNodeMapping::OwnerOnly;
+	}
+	return actorCDO->NetDormancy > DORM_Awake ? EMPClassRepNodeMapping::SpatializeDormancy : EMPClassRepNodeMapping::SpatializeDynamic;
+}
+
+EMPClassRepNodeMapping UMPReplicationGraph::GetMappingPolicy(UClass* actorClass)
+{
+	EMPClassRepNodeMapping* policy = classRepNodePolicies.Get(actorClass);
+	return policy ? *policy : EMPClassRepNodeMapping::NotRouted;
+}
+
+void UMPReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// explicit routes for the game classes, everything else falls back to its CDO flags
+	classRepNodePolicies.Set(AMPCharacter::StaticClass(), EMPClassRepNodeMapping::SpatializeDynamic);
+	classRepNodePolicies.Set(AMPEnvActorComp::StaticClass(), EMPClassRepNodeMapping::SpatializeDormancy);
+	classRepNodePolicies.Set(AMPEnvActorCompFracture::StaticClass(), EMPClassRepNodeMapping::SpatializeDynamic);
+	classRepNodePolicies.Set(AMPItem::StaticClass(), EMPClassRepNodeMapping::SpatializeDormancy);
+	classRepNodePolicies.Set(AMPAbility::StaticClass(), EMPClassRepNodeMapping::OwnerOnly);
+	classRepNodePolicies.Set(AGameStateBase::StaticClass(), EMPClassRepNodeMapping::RelevantAllConnections);
+	classRepNodePolicies.Set(APlayerState::StaticClass(), EMPClassRepNodeMapping::RelevantAllConnections);
+	classRepNodePolicies.Set(APlayerController::StaticClass(), EMPClassRepNodeMapping::OwnerOnly);
+
+	// Blueprint subclasses resolve to their native parent through the class maps
+	for (TObjectIterator<UClass> classIt; classIt; ++classIt)
+	{
+		UClass* actorClass = *classIt;
+		if (!actorClass->IsChildOf(AActor::StaticClass()) || !actorClass->IsNative()) continue;
+		if (actorClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated)) continue;
+
+		const AActor* actorCDO = GetDefault<AActor>(actorClass);
+		if (!actorCDO->GetIsReplicated()) continue;
+
+		if (!classRepNodePolicies.Contains(actorClass, false))
+		{
+			classRepNodePolicies.Set(actorClass, GetDefaultMappingPolicy(actorClass));
+		}
+
+		FClassReplicationInfo classInfo;
+		classInfo.SetCullDistanceSquared(actorCDO->NetCullDistanceSquared);
+		classInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(FMath::Max(actorCDO->NetUpdateFrequency, 1.0f));
+		GlobalActorReplicationInfoMap.SetClassInfo(actorClass, classInfo);
+	}
+}
+
+// nodes
+void UMPReplicationGraph::InitGlobalGraphNodes()
+{
+	gridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	gridNode->CellSize = gridCellSize;
+	gridNode->SpatialBias = gridSpatialBias;
+	AddGlobalGraphNode(gridNode);
+
+	alwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(alwaysRelevantNode);
+}
+
+void UMPReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* repGraphConnection)
+{
+	Super::InitConnectionGraphNodes(repGraphConnection);
+
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* ownerOnlyNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(ownerOnlyNode, repGraphConnection);
+	ownerOnlyNodes.Add(repGraphConnection->NetConnection, ownerOnlyNode);
+}
+
+void UMPReplicationGraph::OnRemoveConnectionGraphNodes(UNetReplicationGraphConnection* repGraphConnection)
+{
+	ownerOnlyNodes.Remove(repGraphConnection->NetConnection);
+
+	Super::OnRemoveConnectionGraphNodes(repGraphConnection);
+}
+
+// routing
+void UMPReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& actorInfo, FGlobalActorReplicationInfo& globalInfo)
+{
+	const EMPClassRepNodeMapping policy = GetMappingPolicy(actorInfo.Class);
+	switch (policy)
+	{
+	case EMPClassRepNodeMapping::RelevantAllConnections:
+		alwaysRelevantNode->NotifyAddNetworkActor(actorInfo);
+		break;
+	case EMPClassRepNodeMapping::OwnerOnly:
+		if (!AddOwnerOnlyActor(actorInfo.Actor))
+		{
+			pendingOwnerOnlyActors.Add(actorInfo.Actor);
+		}
+		break;
+	case EMPClassRepNodeMapping::SpatializeStatic:
+	case EMPClassRepNodeMapping::SpatializeDynamic:
+	case EMPClassRepNodeMapping::SpatializeDormancy:
+		// per actor, items set theirs from Blueprint in BeginPlay
+		globalInfo.Settings.SetCullDistanceSquared(actorInfo.Actor->NetCullDistanceSquared);
+		AddToGrid(actorInfo, globalInfo, policy);
+		break;
+	default:
+		break;
+	}
+}
+
+void UMPReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& actorInfo)
+{
+	// a held item replicates with its owner's pawn, whatever its class policy says
+	if (RemoveHeldItem(actorInfo.Actor)) return;
+
+	// whatever a removed pawn still held goes back to the world
+	TArray<AActor*> orphanedItems;
+	for (const TPair<TWeakObjectPtr<AActor>, TWeakObjectPtr<AActor>>& heldItem : heldItemOwners)
+	{
+		if (heldItem.Value.Get() == actorInfo.Actor && heldItem.Key.IsValid())
+		{
+			orphanedItems.Add(heldItem.Key.Get());
+		}
+	}
+	for (AActor* orphanedItem : orphanedItems)
+	{
+		RemoveHeldItem(orphanedItem);
+		AddToGrid(FNewReplicatedActorInfo(orphanedItem), GlobalActorReplicationInfoMap.Get(orphanedItem), GetMappingPolicy(orphanedItem->GetClass()));
+	}
+
+	const EMPClassRepNodeMapping policy = GetMappingPolicy(actorInfo.Class);
+	switch (policy)
+	{
+	case EMPClassRepNodeMapping::RelevantAllConnections:
+		alwaysRelevantNode->NotifyRemoveNetworkActor(actorInfo);
+		break;
+	case EMPClassRepNodeMapping::OwnerOnly:
+		RemoveOwnerOnlyActor(actorInfo);
+		break;
+	case EMPClassRepNodeMapping::SpatializeStatic:
+	case EMPClassRepNodeMapping::SpatializeDynamic:
+	case EMPClassRepNodeMapping::SpatializeDormancy:
+		RemoveFromGrid(actorInfo, policy);
+		break;
+	default:
+		break;
+	}
+}
+
+void UMPReplicationGraph::AddToGrid(const FNewReplicatedActorInfo& actorInfo, FGlobalActorReplicationInfo& globalInfo, EMPClassRepNodeMapping policy)
+{
+	switch (policy)
+	{
+	case EMPClassRepNodeMapping::SpatializeStatic:
+		gridNode->AddActor_Static(actorInfo, globalInfo);
+		break;
+	case EMPClassRepNodeMapping::SpatializeDormancy:
+		gridNode->AddActor_Dormancy(actorInfo, globalInfo);
+		break;
+	default:
+		gridNode->AddActor_Dynamic(actorInfo, globalInfo);
+		break;
+	}
+}
+
+void UMPReplicationGraph::RemoveFromGrid(const FNewReplicatedActorInfo& actorInfo, EMPClassRepNodeMapping policy)
+{
+	switch (policy)
+	{
+	case EMPClassRepNodeMapping::SpatializeStatic:
+		gridNode->RemoveActor_Static(actorInfo);
+		break;
+	case EMPClassRepNodeMapping::SpatializeDormancy:
+		gridNode->RemoveActor_Dormancy(actorInfo);
+		break;
+	default:
+		gridNode->RemoveActor_Dynamic(actorInfo);
+		break;
+	}
+}
+
+bool UMPReplicationGraph::RemoveHeldItem(AActor* item)
+{
+	const TWeakObjectPtr<AActor>* heldOwner = heldItemOwners.Find(item);
+	if (!heldOwner) return false;
+
+	if (AActor* previousOwner = heldOwner->Get())
+	{
+		GlobalActorReplicationInfoMap.RemoveDependentActor(previousOwner, item);
+	}
+	heldItemOwners.Remove(item);
+	return true;
+}
+
+// owner only
+bool UMPReplicationGraph::AddOwnerOnlyActor(AActor* actor)
+{
+	if (!actor) return true;
+
+	UNetConnection* connection = actor->GetNetConnection();
+	if (UReplicationGraphNode_AlwaysRelevant_ForConnection** ownerOnlyNode = connection ? ownerOnlyNodes.Find(connection) : nullptr)
+	{
+		(*ownerOnlyNode)->NotifyAddNetworkActor(FNewReplicatedActorInfo(actor));
+		return true;
+	}
+
+	// owned by a bot: no connection will ever want it
+	const AActor* netOwner = actor->GetNetOwner();
+	if (netOwner && netOwner->IsA<AController>() && !netOwner->IsA<APlayerController>())
+	{
+		return true;
+	}
+	return false;
+}
+
+void UMPReplicationGraph::RemoveOwnerOnlyActor(const FNewReplicatedActorInfo& actorInfo)
+{
+	if (pendingOwnerOnlyActors.RemoveSingleSwap(actorInfo.Actor, false) > 0) return;
+
+	// the owner may already be gone, so do not trust GetNetConnection here
+	for (TPair<UNetConnection*, UReplicationGraphNode_AlwaysRelevant_ForConnection*>& ownerOnlyNode : ownerOnlyNodes)
+	{
+		if (ownerOnlyNode.Value->NotifyRemoveNetworkActor(actorInfo, false)) return;
+	}
+}
+
+void UMPReplicationGraph::ResolvePendingOwnerOnlyActors()
+{
+	for (int32 i = pendingOwnerOnlyActors.Num() - 1; i >= 0; i--)
+	{
+		AActor* pendingActor = pendingOwnerOnlyActors[i];
+		if (!IsValid(pendingActor) || AddOwnerOnlyActor(pendingActor))
+		{
+			pendingOwnerOnlyActors.RemoveAtSwap(i, 1, false);
+		}
+	}
+}
+
+void UMPReplicationGraph::NotifyNetOwnerChanged(AActor* actor)
+{
+	if (!actor || !gridNode) return;
+
+	const FNewReplicatedActorInfo actorInfo(actor);
+	const EMPClassRepNodeMapping policy = GetMappingPolicy(actor->GetClass());
+
+	if (policy == EMPClassRepNodeMapping::OwnerOnly)
+	{
+		RemoveOwnerOnlyActor(actorInfo);
+		if (!AddOwnerOnlyActor(actor))
+		{
+			pendingOwnerOnlyActors.Add(actor);
+		}
+		return;
+	}
+
+	// leave where it is now
+	if (!RemoveHeldItem(actor))
+	{
+		RemoveFromGrid(actorInfo, policy);
+	}
+
+	// a held item replicates along with its owner's pawn, player or bot, so it is relevant wherever that pawn is
+	if (AActor* newOwner = actor->GetOwner())
+	{
+		GlobalActorReplicationInfoMap.AddDependentActor(newOwner, actor);
+		heldItemOwners.Add(actor, newOwner);
+	}
+	else
+	{
+		AddToGrid(actorInfo, GlobalActorReplicationInfoMap.Get(actor), policy);
+	}
+}
+
+int32 UMPReplicationGraph::ServerReplicateActors(float deltaSeconds)
+{
+	ResolvePendingOwnerOnlyActors();
+
+	const double startTime = FPlatformTime::Seconds();
+	const int32 replicatedActors = Super::ServerReplicateActors(deltaSeconds);
+	lastReplicateSeconds = FPlatformTime::Seconds() - startTime;
+
+	return replicatedActors;
+}
+
+// =====================
+// Net tick benchmark
+// =====================
+
+namespace
+{
+	// times the world's tick flush, which is where every net driver replicates, so the numbers
+	// compare the graph against -NoMPRepGraph on the same map
+	struct FMPNetTickBenchmark
+	{
+		TWeakObjectPtr<UWorld> world;
+		double endTime = 0.0;
+		double flushStartTime = 0.0;
+		TArray<double> netTickMs;
+		TArray<double> graphMs;
+		FDelegateHandle preTickFlushHandle;
+		FDelegateHandle postTickFlushHandle;
+
+		bool IsRunning() const { return world.IsValid(); }
+
+		void Start(UWorld* inWorld, float seconds)
+		{
+			Stop();
+
+			world = inWorld;
+			endTime = FPlatformTime::Seconds() + seconds;
+			netTickMs.Reset();
+			graphMs.Reset();
+
+			preTickFlushHandle = inWorld->OnPreTickFlush().AddLambda([this](float)
+			{
+				flushStartTime = FPlatformTime::Seconds();
+			});
+			postTickFlushHandle = inWorld->OnPostTickFlush().AddLambda([this]()
+			{
+				OnPostTickFlush();
+			});
+		}
+
+		void Stop()
+		{
+			if (UWorld* benchmarkWorld = world.Get())
+			{
+				benchmarkWorld->OnPreTickFlush().Remove(preTickFlushHandle);
+				benchmarkWorld->OnPostTickFlush().Remove(postTickFlushHandle);
+			}
+			world.Reset();
+		}
+
+		void OnPostTickFlush()
+		{
+			const double now = FPlatformTime::Seconds();
+			if (flushStartTime > 0.0)
+			{
+				netTickMs.Add((now - flushStartTime) * 1000.0);
+			}
+			if (UMPReplicationGraph* graph = UMPReplicationGraph::Get(world.Get()))
+			{
+				graphMs.Add(graph->GetLastReplicateSeconds() * 1000.0);
+			}
+
+			if (now >= endTime)
+			{
+				Report();
+				Stop();
+			}
+		}
+
+		static double Percentile(TArray<double>& samples, float percentile)
+		{
+			if (samples.Num() == 0) return 0.0;
+			samples.Sort();
+			return samples[FMath::Clamp(FMath::CeilToInt(samples.Num() * percentile) - 1, 0, samples.Num() - 1)];
+		}
+
+		static double Average(const TArray<double>& samples)
+		{
+			double total = 0.0;
+			for (double sample : samples) total += sample;
+			return samples.Num() > 0 ? total / samples.Num() : 0.0;
+		}
+
+		void Report()
+		{
+			UWorld* benchmarkWorld = world.Get();
+			if (!benchmarkWorld) return;
+			UNetDriver* netDriver = benchmarkWorld->GetNetDriver();
+
+			int32 players = 0;
+			int32 bots = 0;
+			for (FConstControllerIterator controllerIt = benchmarkWorld->GetControllerIterator(); controllerIt; ++controllerIt)
+			{
+				const AController* controller = controllerIt->Get();
+				if (!controller || !controller->GetPawn()) continue;
+				if (controller->IsA<APlayerController>()) players++;
+				else bots++;
+			}
+
+			MP_LOG_INFO(TEXT("MPNetBenchmark"), TEXT("Net tick over %d frames, %s, %d connections, %d player pawns, %d bot pawns"),
+				netTickMs.Num(), UMPReplicationGraph::Get(benchmarkWorld) ? TEXT("replication graph") : TEXT("default relevancy"),
+				netDriver ? netDriver->ClientConnections.Num() : 0, players, bots);
+			MP_LOG_INFO(TEXT("MPNetBenchmark"), TEXT("Tick flush ms: avg %.3f, p50 %.3f, p95 %.3f, max %.3f"),
+				Average(netTickMs), Percentile(netTickMs, 0.5f), Percentile(netTickMs, 0.95f), Percentile(netTickMs, 1.0f));
+			if (graphMs.Num() > 0)
+			{
+				MP_LOG_INFO(TEXT("MPNetBenchmark"), TEXT("Graph ServerReplicateActors ms: avg %.3f, p95 %.3f, max %.3f"),
+					Average(graphMs), Percentile(graphMs, 0.95f), Percentile(graphMs, 1.0f));
+			}
+		}
+	};
+
+	FMPNetTickBenchmark GMPNetTickBenchmark;
+}
+
+// mp.Net.AddBenchmarkBots [Count], in the lobby before the match starts
+static FAutoConsoleCommandWithWorldAndArgs GMPNetAddBenchmarkBotsCommand(
+	TEXT("mp.Net.AddBenchmarkBots"),
+	TEXT("Server only. Adds bots (alternating cat / human) for the net benchmark. Usage: mp.Net.AddBenchmarkBots [Count=16]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& args, UWorld* world)
+	{
+		AMPGMGameplay* gameMode = world ? world->GetAuthGameMode<AMPGMGameplay>() : nullptr;
+		if (!gameMode)
+		{
+			UManagerLog::LogWarning(TEXT("mp.Net.AddBenchmarkBots needs the gameplay Game Mode on the server"), TEXT("MPNetBenchmark"));
+			return;
+		}
+
+		const int32 botCount = args.Num() > 0 ? FMath::Max(FCString::Atoi(*args[0]), 0) : 16;
+		int32 addedBots = 0;
+		for (int32 i = 0; i < botCount; i++)
+		{
+			if (gameMode->AddBot(i % 2 == 0 ? ETeam::ECat : ETeam::EHuman)) addedBots++;
+		}
+		MP_LOG_INFO(TEXT("MPNetBenchmark"), TEXT("Added %d/%d benchmark bots"), addedBots, botCount);
+	}));
+
+// mp.Net.Benchmark [Seconds], during gameplay with 8 clients connected and the bots spawned
+static FAutoConsoleCommandWithWorldAndArgs GMPNetBenchmarkCommand(
+	TEXT("mp.Net.Benchmark"),
+	TEXT("Server only. Samples the net tick (tick flush) time and logs avg / p50 / p95 / max. Run once as is and once with -NoMPRepGraph to compare. Usage: mp.Net.Benchmark [Seconds=30]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& args, UWorld* world)
+	{
+		if (!world || world->GetNetMode() == NM_Client || world->GetNetMode() == NM_Standalone)
+		{
+			UManagerLog::LogWarning(TEXT("mp.Net.Benchmark only runs on a listen or dedicated server"), TEXT("MPNetBenchmark"));
+			return;
+		}
+
+		const float seconds = args.Num() > 0 ? FMath::Max(FCString::Atof(*args[0]), 1.0f) : 30.0f;
+		GMPNetTickBenchmark.Start(world, seconds);
+		MP_LOG_INFO(TEXT("MPNetBenchmark"), TEXT("Sampling net tick for %.0f s"), seconds);
+	}));
@@ -0,0 +1,114 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This is the replication graph of the game net driver. Instead of asking every replicated actor
+// "are you relevant to this connection?" on every net tick, actors are routed once into graph nodes
+// and each connection only gathers the nodes that can matter to it:
+// - A 2D spatial grid for characters, env actors, fracture pieces and world items. A connection only visits the cells around its viewer.
+// - An always-relevant list for the Game State, player states and anything else flagged `bAlwaysRelevant`.
+// - One always-relevant node per connection for owner-only actors: player controllers and abilities.
+// - Items held in an inventory are dependents of their owner's pawn, so they replicate wherever that pawn does.
+//
+// How to utilize in Blueprint:
+// - It is not exposed to Blueprint. The game module installs it for the game net driver at startup; start with `-NoMPRepGraph` to fall back to the default per-connection relevancy checks.
+//
+// Necessary things to define:
+// - The `ReplicationGraph` plugin must be enabled in the .uproject.
+// - Optional tuning in DefaultEngine.ini under `[/Script/MeowPhone.MPReplicationGraph]`: `gridCellSize`, `gridSpatialBias`. Cull distances are each actor's own `NetCullDistanceSquared`.
+//
+// How it interacts with other classes:
+// - AMPItem: Sets its owner and calls `NotifyNetOwnerChanged` from `BePickedUp` / `BeDroped` / `OnReleasedToPool`, which moves the item between the spatial grid and its owner's pawn. Every connection that sees a player or bot sees what it holds.
+// - AMPAbility: Only relevant to its owner (`bOnlyRelevantToOwner`), routed to the owner's connection node and re-routed through `NotifyNetOwnerChanged` when the pool hands it to another cat.
+// - AMPEnvActorComp / AMPItem: Dormant actors stay in the grid as dormancy-aware entries, so a sleeping actor costs nothing until it wakes.
+// - `mp.Net.AddBenchmarkBots` / `mp.Net.Benchmark`: Server console commands to measure the net tick with 8 players and 16 bots, with or without the graph.
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "MPReplicationGraph.generated.h"
+
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_AlwaysRelevant_ForConnection;
+
+// which node an actor class is routed into
+enum class EMPClassRepNodeMapping : uint8
+{
+	NotRouted,
+	RelevantAllConnections,
+	SpatializeStatic,      // never moves, only added to the cells it starts in
+	SpatializeDynamic,     // moves, grid cell updated every frame
+	SpatializeDormancy,    // treated as static while dormant, dynamic while awake
+	OwnerOnly,             // only the owning connection
+};
+
+UCLASS(Transient, Config = Engine)
+class UMPReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* repGraphConnection) override;
+	virtual void OnRemoveConnectionGraphNodes(UNetReplicationGraphConnection* repGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& actorInfo, FGlobalActorReplicationInfo& globalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& actorInfo) override;
+	virtual int32 ServerReplicateActors(float deltaSeconds) override;
+
+	// null when the world runs without the graph (client, standalone, -NoMPRepGraph)
+	static UMPReplicationGraph* Get(const UWorld* world);
+
+	// call after SetOwner on a routed actor: moves an item between the grid and its owner's pawn, re-routes an owner-only actor
+	void NotifyNetOwnerChanged(AActor* actor);
+
+	// installs the graph for the game net driver, called once by the game module
+	static void RegisterReplicationDriver();
+
+// config
+protected:
+	UPROPERTY(Config)
+		float gridCellSize = 10000.0f;
+	UPROPERTY(Config)
+		FVector2D gridSpatialBias = FVector2D(-150000.0f, -150000.0f);
+
+// nodes
+protected:
+	UPROPERTY()
+		UReplicationGraphNode_GridSpatialization2D* gridNode = nullptr;
+	UPROPERTY()
+		UReplicationGraphNode_ActorList* alwaysRelevantNode = nullptr;
+	UPROPERTY()
+		TMap<UNetConnection*, UReplicationGraphNode_AlwaysRelevant_ForConnection*> ownerOnlyNodes;
+
+	TClassMap<EMPClassRepNodeMapping> classRepNodePolicies;
+
+	// owner-only actors whose connection was not known yet when they were added
+	UPROPERTY()
+		TArray<AActor*> pendingOwnerOnlyActors;
+	// held items currently replicated as dependents of their owner's pawn instead of living in the grid
+	TMap<TWeakObjectPtr<AActor>, TWeakObjectPtr<AActor>> heldItemOwners;
+
+	// the class map caches lookups of subclasses, so these are not const
+	EMPClassRepNodeMapping GetMappingPolicy(UClass* actorClass);
+	EMPClassRepNodeMapping GetDefaultMappingPolicy(UClass* actorClass) const;
+
+	// false when the actor has no connection yet, it is retried every net tick
+	bool AddOwnerOnlyActor(AActor* actor);
+	void RemoveOwnerOnlyActor(const FNewReplicatedActorInfo& actorInfo);
+	void ResolvePendingOwnerOnlyActors();
+
+	void AddToGrid(const FNewReplicatedActorInfo& actorInfo, FGlobalActorReplicationInfo& globalInfo, EMPClassRepNodeMapping policy);
+	void RemoveFromGrid(const FNewReplicatedActorInfo& actorInfo, EMPClassRepNodeMapping policy);
+
+	// detaches a held item from its owner's pawn, false when the actor is not a held item
+	bool RemoveHeldItem(AActor* item);
+
+// benchmark
+public:
+	// wall time of the last ServerReplicateActors, in seconds
+	double GetLastReplicateSeconds() const { return lastReplicateSeconds; }
+
+protected:
+	double lastReplicateSeconds = 0.0;
+};
@@ -0,0 +1,246 @@
+#include "MPSoundEventChannel.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundCue.h"
+
+#include "MPGS.h"
+#include "Managers/ManagerLog.h"
+#include "../MPActor/Player/MPControllerPlayer.h"
+
+void UMPSoundEventChannel::Deinitialize()
+{
+	pendingEvents.Empty();
+	recentEvents.Empty();
+	unknownEvents.Empty();
+	clientSoundRates.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UMPSoundEventChannel::IsTickable() const
+{
+	return Super::IsTickable() && pendingEvents.Num() > 0;
+}
+
+TStatId UMPSoundEventChannel::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMPSoundEventChannel, STATGROUP_Tickables);
+}
+
+void UMPSoundEventChannel::Tick(float deltaTime)
+{
+	Super::Tick(deltaTime);
+	FlushPendingEvents();
+}
+
+void UMPSoundEventChannel::BroadcastSound(const UObject* worldContextObject, USoundCue* sound, const FVector& location)
+{
+	if (!IsValid(sound) || !worldContextObject) return;
+
+	UWorld* world = worldContextObject->GetWorld();
+	if (!world) return;
+
+	if (world->GetNetMode() != NM_Client)
+	{
+		if (UMPSoundEventChannel* channel = world->GetSubsystem<UMPSoundEventChannel>())
+		{
+			channel->QueueSoundEvent(sound, location, nullptr);
+		}
+		return;
+	}
+
+	// a client hears its own sound without waiting for the round trip, the server skips it when flushing
+	UGameplayStatics::PlaySoundAtLocation(world, sound, location);
+	if (AMPControllerPlayer* localController = Cast<AMPControllerPlayer>(world->GetFirstPlayerController()))
+	{
+		localController->ServerBroadcastSoundEvent(sound, location);
+	}
+}
+
+// server queue
+void UMPSoundEventChannel::QueueSoundEvent(USoundCue* sound, const FVector& location, AController* instigatorController)
+{
+	if (!IsValid(sound)) return;
+
+	UWorld* world = GetWorld();
+	AMPGS* theGameState = world ? world->GetGameState<AMPGS>() : nullptr;
+	if (!theGameState) return;
+
+	const uint16 soundId = theGameState->FindOrAddSoundEventId(sound);
+	if (soundId == AMPGS::InvalidSoundEventId) return;
+
+	if (IsDuplicate(soundId, location, world->GetTimeSeconds())) return;
+
+	FQueuedSoundEvent& queued = pendingEvents.AddDefaulted_GetRef();
+	queued.record.soundId = soundId;
+	queued.record.location = location;
+	queued.instigatorController = instigatorController;
+}
+
+void UMPSoundEventChannel::QueueClientSoundEvent(USoundCue* sound, const FVector& location, AController* senderController)
+{
+	UWorld* world = GetWorld();
+	if (!world || !IsValid(sound) || !senderController) return;
+
+	// a client without a pawn has nothing in the world to make a sound with
+	const APawn* senderPawn = senderController->GetPawn();
+	if (!senderPawn) return;
+
+	if (!IsClientSoundAllowed(sound))
+	{
+		MP_LOG_WARNING(TEXT("MPSoundEventChannel"), TEXT("%s reported sound %s that is neither broadcast yet nor allowed"), *senderController->GetName(), *sound->GetName());
+		return;
+	}
+
+	if (!ConsumeClientSoundBudget(senderController, world->GetTimeSeconds())) return;
+
+	// the client only knows roughly where its own sound is, it cannot place one across the map
+	const FVector pawnLocation = senderPawn->GetActorLocation();
+	const FVector clampedLocation = pawnLocation + (location - pawnLocation).GetClampedToMaxSize(maxClientSoundDistance);
+
+	QueueSoundEvent(sound, clampedLocation, senderController);
+}
+
+bool UMPSoundEventChannel::IsClientSoundAllowed(USoundCue* sound) const
+{
+	// a cue the server broadcast itself costs no new table entry
+	AMPGS* theGameState = GetWorld()->GetGameState<AMPGS>();
+	if (theGameState && theGameState->FindSoundEventId(sound) != AMPGS::InvalidSoundEventId) return true;
+
+	const FSoftObjectPath soundPath(sound);
+	return clientSoundAllowList.ContainsByPredicate([&soundPath](const TSoftObjectPtr<USoundCue>& allowed) { return allowed.ToSoftObjectPath() == soundPath; });
+}
+
+bool UMPSoundEventChannel::ConsumeClientSoundBudget(AController* senderController, double now)
+{
+	FClientSoundRate& rate = clientSoundRates.FindOrAdd(TObjectKey<AController>(senderController));
+	if (now - rate.windowStart >= 1.0)
+	{
+		rate.windowStart = now;
+		rate.count = 0;
+	}
+	return ++rate.count <= maxClientSoundsPerSecond;
+}
+
+bool UMPSoundEventChannel::IsDuplicate(uint16 soundId, const FVector& location, double now)
+{
+	// recent events are in time order, drop the ones that left the window
+	const double windowStart = now - dedupWindowSeconds;
+	int32 firstLive = 0;
+	while (firstLive < recentEvents.Num() && recentEvents[firstLive].time < windowStart) ++firstLive;
+	if (firstLive > 0) recentEvents.RemoveAt(0, firstLive, false);
+
+	const float dedupDistanceSquared = dedupDistance * dedupDistance;
+	for (const FRecentSoundEvent& recent : recentEvents)
+	{
+		if (recent.soundId == soundId && FVector::DistSquared(recent.location, location) <= dedupDistanceSquared)
+		{
+			return true;
+		}
+	}
+
+	FRecentSoundEvent& added = recentEvents.AddDefaulted_GetRef();
+	added.soundId = soundId;
+	added.location = location;
+	added.time = now;
+	return false;
+}
+
+void UMPSoundEventChannel::FlushPendingEvents()
+{
+	UWorld* world = GetWorld();
+	if (!world || pendingEvents.Num() == 0) return;
+
+	const float audibleDistanceSquared = audibleDistance * audibleDistance;
+
+	for (FConstPlayerControllerIterator iterator = world->GetPlayerControllerIterator(); iterator; ++iterator)
+	{
+		AMPControllerPlayer* playerController = Cast<AMPControllerPlayer>(iterator->Get());
+		if (!playerController) continue;
+
+		// without a pawn (lobby, spectating) there is nothing to measure from, everything is sent
+		const APawn* listener = playerController->GetPawn();
+
+		batchScratch.Reset();
+		for (const FQueuedSoundEvent& queued : pendingEvents)
+		{
+			if (queued.instigatorController.Get() == playerController) continue;
+			if (listener && FVector::DistSquared(listener->GetActorLocation(), queued.record.location) > audibleDistanceSquared) continue;
+
+			batchScratch.Add(queued.record);
+			if (batchScratch.Num() >= maxEventsPerBatch) break;
+		}
+
+		if (batchScratch.Num() == 0) continue;
+
+		if (playerController->IsLocalController())
+		{
+			PlaySoundEvents(batchScratch);
+		}
+		else
+		{
+			playerController->ClientPlaySoundEvents(batchScratch);
+		}
+	}
+
+	// a dedicated server has no local controller, nobody plays the sound there
+	pendingEvents.Reset();
+}
+
+// client
+void UMPSoundEventChannel::PlaySoundEvents(const TArray<FMPSoundEvent>& soundEvents)
+{
+	UWorld* world = GetWorld();
+	AMPGS* theGameState = world ? world->GetGameState<AMPGS>() : nullptr;
+
+	for (const FMPSoundEvent& soundEvent : soundEvents)
+	{
+		if (theGameState && theGameState->GetSoundEventSound(soundEvent.soundId))
+		{
+			PlaySoundEvent(soundEvent);
+		}
+		else
+		{
+			FUnknownSoundEvent& unknown = unknownEvents.AddDefaulted_GetRef();
+			unknown.record = soundEvent;
+			unknown.receivedTime = world ? world->GetTimeSeconds() : 0.0;
+		}
+	}
+}
+
+void UMPSoundEventChannel::ResolveUnknownSoundEvents()
+{
+	UWorld* world = GetWorld();
+	AMPGS* theGameState = world ? world->GetGameState<AMPGS>() : nullptr;
+	if (!theGameState || unknownEvents.Num() == 0) return;
+
+	const double oldestPlayable = world->GetTimeSeconds() - unknownSoundMaxAge;
+	for (int32 index = unknownEvents.Num() - 1; index >= 0; --index)
+	{
+		const FUnknownSoundEvent& unknown = unknownEvents[index];
+		if (unknown.receivedTime < oldestPlayable)
+		{
+			// too late to still sound like the event that caused it
+			unknownEvents.RemoveAt(index, 1, false);
+		}
+		else if (theGameState->GetSoundEventSound(unknown.record.soundId))
+		{
+			PlaySoundEvent(unknown.record);
+			unknownEvents.RemoveAt(index, 1, false);
+		}
+	}
+}
+
+void UMPSoundEventChannel::PlaySoundEvent(const FMPSoundEvent& soundEvent)
+{
+	UWorld* world = GetWorld();
+	AMPGS* theGameState = world ? world->GetGameState<AMPGS>() : nullptr;
+	if (!theGameState) return;
+
+	if (USoundCue* sound = theGameState->GetSoundEventSound(soundEvent.soundId))
+	{
+		UGameplayStatics::PlaySoundAtLocation(world, sound, soundEvent.location);
+	}
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This world subsystem is the one channel every broadcast gameplay sound goes through. Instead of each
+// character, item and env actor sending its own reliable Server RPC and NetMulticast per sound, the
+// server queues sound events here and sends them once per frame:
+// - An event is a compact record: a 16 bit sound id from the Game State's sound table plus a quantized location.
+// - The same sound played again within `dedupWindowSeconds` and `dedupDistance` of an earlier one is collapsed into it.
+// - Each player only receives the events within `audibleDistance` of its pawn, in one unreliable Client RPC per frame.
+//
+// How to utilize in Blueprint:
+// - It is not exposed to Blueprint. Call `PlaySoundBroadcast` on any actor implementing IMPPlaySoundInterface; it forwards to `BroadcastSound`.
+//
+// Necessary things to define:
+// - Optional tuning in DefaultGame.ini under `[/Script/MeowPhone.MPSoundEventChannel]`: `dedupWindowSeconds`, `dedupDistance`, `audibleDistance`, `maxEventsPerBatch`.
+// - `+clientSoundAllowList=` for every cue a client may report before the server has broadcast it itself. `maxClientSoundDistance` and `maxClientSoundsPerSecond` bound what one client can send.
+//
+// How it interacts with other classes:
+// - AMPCharacter, AMPItem, AMPEnvActorComp: Their `PlaySoundBroadcast` calls `BroadcastSound` with the actor location.
+// - AMPControllerPlayer: A client plays its own sound at once and reports it with `ServerBroadcastSoundEvent`, so it is not sent back to it. `QueueClientSoundEvent` accepts the report only for a known or allowed cue, pulls the location to near the sender's pawn, and throttles each connection. Batches arrive through `ClientPlaySoundEvents`.
+// - AMPGS: Holds the replicated sound table that maps ids to sound cues. Events that arrive before their id has replicated wait for `OnRep_SoundEventTable`.
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/NetSerialization.h"
+#include "MPSoundEventChannel.generated.h"
+
+class USoundCue;
+class AController;
+
+// one broadcast sound, as sent to the clients
+USTRUCT()
+struct FMPSoundEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+		uint16 soundId = 0;
+	UPROPERTY()
+		FVector_NetQuantize location = FVector::ZeroVector;
+};
+
+UCLASS(Config = Game)
+class UMPSoundEventChannel : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float deltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	// plays the sound for every player in range, callable on the server and on clients
+	static void BroadcastSound(const UObject* worldContextObject, USoundCue* sound, const FVector& location);
+
+	// server only, instigatorController already played the sound locally and is skipped
+	void QueueSoundEvent(USoundCue* sound, const FVector& location, AController* instigatorController);
+
+	// server only, a sound reported by a client; dropped unless the cue is known or allowed and the sender is within its rate
+	void QueueClientSoundEvent(USoundCue* sound, const FVector& location, AController* senderController);
+
+	// client side of a batch, also used by the listen server host
+	void PlaySoundEvents(const TArray<FMPSoundEvent>& soundEvents);
+
+	// called by AMPGS when new sound ids arrive
+	void ResolveUnknownSoundEvents();
+
+// config
+protected:
+	UPROPERTY(Config)
+		float dedupWindowSeconds = 0.1f;
+	UPROPERTY(Config)
+		float dedupDistance = 100.0f;
+	UPROPERTY(Config)
+		float audibleDistance = 6000.0f;
+	UPROPERTY(Config)
+		int32 maxEventsPerBatch = 32;
+	// how long a client keeps an event whose sound id has not replicated yet
+	UPROPERTY(Config)
+		float unknownSoundMaxAge = 0.5f;
+	// cues a client may report that are not in the Game State sound table yet
+	UPROPERTY(Config)
+		TArray<TSoftObjectPtr<USoundCue>> clientSoundAllowList;
+	// a client reported location further than this from its pawn is pulled in to this distance
+	UPROPERTY(Config)
+		float maxClientSoundDistance = 1500.0f;
+	UPROPERTY(Config)
+		int32 maxClientSoundsPerSecond = 10;
+
+// server queue
+protected:
+	struct FQueuedSoundEvent
+	{
+		FMPSoundEvent record;
+		TWeakObjectPtr<AController> instigatorController;
+	};
+
+	struct FRecentSoundEvent
+	{
+		uint16 soundId = 0;
+		FVector location = FVector::ZeroVector;
+		double time = 0.0;
+	};
+
+	struct FClientSoundRate
+	{
+		double windowStart = 0.0;
+		int32 count = 0;
+	};
+
+	TArray<FQueuedSoundEvent> pendingEvents;
+	TArray<FRecentSoundEvent> recentEvents;
+	TArray<FMPSoundEvent> batchScratch;
+	TMap<TObjectKey<AController>, FClientSoundRate> clientSoundRates;
+
+	bool IsClientSoundAllowed(USoundCue* sound) const;
+	bool ConsumeClientSoundBudget(AController* senderController, double now);
+
+	bool IsDuplicate(uint16 soundId, const FVector& location, double now);
+	void FlushPendingEvents();
+
+// client
+protected:
+	struct FUnknownSoundEvent
+	{
+		FMPSoundEvent record;
+		double receivedTime = 0.0;
+	};
+
+	TArray<FUnknownSoundEvent> unknownEvents;
+
+	void PlaySoundEvent(const FMPSoundEvent& soundEvent);
+};
@@ -0,0 +1,109 @@
+#include "MPWanderPointCache.h"
+
+#include "Engine/World.h"
+#include "NavigationSystem.h"
+
+#include "Managers/ManagerLog.h"
+
+DECLARE_STATS_GROUP(TEXT("MPWander"), STATGROUP_MPWander, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cached Points"), STAT_MPWanderPoints, STATGROUP_MPWander);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cached Cells"), STAT_MPWanderCells, STATGROUP_MPWander);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cache Picks"), STAT_MPWanderCachePicks, STATGROUP_MPWander);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cache Misses"), STAT_MPWanderCacheMisses, STATGROUP_MPWander);
+DECLARE_CYCLE_STAT(TEXT("Build Cache"), STAT_MPWanderBuild, STATGROUP_MPWander);
+
+void UMPWanderPointCache::Deinitialize()
+{
+	cells.Empty();
+	numPoints = 0;
+
+	Super::Deinitialize();
+}
+
+FIntPoint UMPWanderPointCache::GetCell(const FVector& location) const
+{
+	return FIntPoint(FMath::FloorToInt(location.X / builtCellSize), FMath::FloorToInt(location.Y / builtCellSize));
+}
+
+void UMPWanderPointCache::BuildCache()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MPWanderBuild);
+
+	cells.Reset();
+	numPoints = 0;
+
+	UNavigationSystemV1* navSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!navSystem) return;
+
+	const FBox navBounds = navSystem->GetNavigableWorldBounds();
+	if (!navBounds.IsValid)
+	{
+		MP_LOG_WARNING(TEXT("MPWanderPointCache"), TEXT("No navigable bounds, bots will query the navmesh for every wander"));
+		return;
+	}
+
+	const FVector navSize = navBounds.GetSize();
+	builtCellSize = FMath::Max(cellSize, FMath::Sqrt(navSize.X * navSize.Y / FMath::Max(maxCells, 1)));
+
+	const int32 numCellsX = FMath::Max(FMath::CeilToInt(navSize.X / builtCellSize), 1);
+	const int32 numCellsY = FMath::Max(FMath::CeilToInt(navSize.Y / builtCellSize), 1);
+	const float sampleRadius = builtCellSize * 0.5f;
+
+	for (int32 cellX = 0; cellX < numCellsX; ++cellX)
+	{
+		for (int32 cellY = 0; cellY < numCellsY; ++cellY)
+		{
+			const FVector cellCentre(navBounds.Min.X + (cellX + 0.5f) * builtCellSize, navBounds.Min.Y + (cellY + 0.5f) * builtCellSize, navBounds.GetCenter().Z);
+
+			// a cell with nothing navigable near its centre fails its first sample, the rest are skipped
+			for (int32 sample = 0; sample < pointsPerCell; ++sample)
+			{
+				FNavLocation navLocation;
+				if (!navSystem->GetRandomPointInNavigableRadius(cellCentre, sampleRadius, navLocation))
+				{
+					break;
+				}
+
+				// a sample can land in a neighbouring cell, it is filed where it actually is
+				cells.FindOrAdd(GetCell(navLocation.Location)).Add(navLocation.Location);
+				++numPoints;
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_MPWanderPoints, numPoints);
+	SET_DWORD_STAT(STAT_MPWanderCells, cells.Num());
+	MP_LOG_INFO(TEXT("MPWanderPointCache"), TEXT("Cached %d wander points in %d cells of %.0f"), numPoints, cells.Num(), builtCellSize);
+}
+
+bool UMPWanderPointCache::PickPoint(const FVector& origin, float radius, FVector& outPoint, float minDistance) const
+{
+	if (numPoints == 0 || radius <= 0.0f)
+	{
+		INC_DWORD_STAT(STAT_MPWanderCacheMisses);
+		return false;
+	}
+
+	const FIntPoint minCell = GetCell(origin - FVector(radius, radius, 0.0f));
+	const FIntPoint maxCell = GetCell(origin + FVector(radius, radius, 0.0f));
+	const float radiusSquared = radius * radius;
+	const float minDistanceSquared = minDistance * minDistance;
+
+	for (int32 attempt = 0; attempt < pickAttempts; ++attempt)
+	{
+		const FIntPoint cell(FMath::RandRange(minCell.X, maxCell.X), FMath::RandRange(minCell.Y, maxCell.Y));
+		const TArray<FVector>* cellPoints = cells.Find(cell);
+		if (!cellPoints || cellPoints->Num() == 0) continue;
+
+		const FVector& candidate = (*cellPoints)[FMath::RandRange(0, cellPoints->Num() - 1)];
+		const float distanceSquared = FVector::DistSquared(origin, candidate);
+		if (distanceSquared > radiusSquared || distanceSquared < minDistanceSquared) continue;
+
+		outPoint = candidate;
+		INC_DWORD_STAT(STAT_MPWanderCachePicks);
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_MPWanderCacheMisses);
+	return false;
+}
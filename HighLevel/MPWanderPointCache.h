@@ -0,0 +1,64 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This world subsystem holds the wander points bots pick from. It samples navigable points over the
+// whole navmesh once, at match setup, and buckets them in a 2D grid of `cellSize` cells. A wander
+// request then picks a random cell overlapping the wander radius and a random point in it, both by
+// index. This replaces a navmesh query per wander. A live query only runs when no cached point near
+// the bot is in range.
+//
+// How to utilize in Blueprint:
+// - It is not exposed to Blueprint. `BTTask_MoveRandomPoint` goes through `AMPAIController::MoveToRandomPoint`, which asks the cache first.
+//
+// Necessary things to define:
+// - A NavMeshBoundsVolume in the level, like any bot movement.
+// - Optional tuning in DefaultGame.ini under `[/Script/MeowPhone.MPWanderPointCache]`: `cellSize`, `pointsPerCell`, `maxCells`.
+//
+// How it interacts with other classes:
+// - UManagerMatch: `SetupMapWanderPoints` calls `BuildCache` during `SetupMap`, before any bot spawns.
+// - AMPAIController: `MoveToRandomPoint` calls `PickPoint`. It falls back to `GetRandomReachablePointInRadius` when `PickPoint` returns false, or when the cached point cannot be reached from where the bot stands.
+// - `stat MPWander`: Cached points and cells, and how many wanders were served from the cache or fell back to a live query.
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MPWanderPointCache.generated.h"
+
+UCLASS(Config = Game)
+class UMPWanderPointCache : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// samples the navmesh; safe to call again after the navmesh changed
+	void BuildCache();
+
+	// a random cached point within radius of origin and at least minDistance away; false when there is none nearby
+	bool PickPoint(const FVector& origin, float radius, FVector& outPoint, float minDistance = 100.0f) const;
+
+	bool IsBuilt() const { return numPoints > 0; }
+	int32 GetNumPoints() const { return numPoints; }
+
+// config
+protected:
+	UPROPERTY(Config)
+		float cellSize = 1000.0f;
+	UPROPERTY(Config)
+		int32 pointsPerCell = 6;
+	// on a big map the cells grow until they fit in this many
+	UPROPERTY(Config)
+		int32 maxCells = 4096;
+	// random cells tried per pick before giving up on the cache
+	UPROPERTY(Config)
+		int32 pickAttempts = 6;
+
+// grid
+protected:
+	float builtCellSize = 0.0f;
+	int32 numPoints = 0;
+	TMap<FIntPoint, TArray<FVector>> cells;
+
+	FIntPoint GetCell(const FVector& location) const;
+};
@@ -0,0 +1,101 @@
+#include "MPWorldRegistry.h"
+
+#include "Engine/World.h"
+
+#include "MPGS.h"
+
+#include "../MPActor/Item/MPItem.h"
+#include "../MPActor/EnvActor/MPEnvActorComp.h"
+#include "../MPActor/AI/MPAIControllerHumanPlayer.h"
+#include "../MPActor/AI/MPAIController.h"
+#include "../MPActor/AI/MPAISystemManager.h"
+#include "../MPActor/Character/MPCharacter.h"
+#include "../MPActor/Character/MPCharacterHuman.h"
+#include "../MPActor/Character/MPCharacterCat.h"
+
+void UMPWorldRegistry::Deinitialize()
+{
+	allItems.Empty();
+	allEnvActors.Empty();
+	allAIHumanControllers.Empty();
+	allCharacters.Empty();
+	allAIControllers.Empty();
+	aiSystemManager = nullptr;
+
+	Super::Deinitialize();
+}
+
+AMPGS* UMPWorldRegistry::GetAuthorityGameState() const
+{
+	UWorld* world = GetWorld();
+	if (!world || world->GetNetMode() == NM_Client) return nullptr;
+	return world->GetGameState<AMPGS>();
+}
+
+void UMPWorldRegistry::RegisterItem(AMPItem* item)
+{
+	if (item) allItems.AddUnique(item);
+	if (AMPGS* theGameState = GetAuthorityGameState()) theGameState->AddEntity(EEntityList::EItem, item);
+}
+void UMPWorldRegistry::UnregisterItem(AMPItem* item)
+{
+	allItems.RemoveSingleSwap(item, false);
+	if (AMPGS* theGameState = GetAuthorityGameState()) theGameState->RemoveEntity(EEntityList::EItem, item);
+}
+
+void UMPWorldRegistry::RegisterEnvActor(AMPEnvActorComp* envActor)
+{
+	if (envActor) allEnvActors.AddUnique(envActor);
+	if (AMPGS* theGameState = GetAuthorityGameState()) theGameState->AddEntity(EEntityList::EEnvActor, envActor);
+}
+void UMPWorldRegistry::UnregisterEnvActor(AMPEnvActorComp* envActor)
+{
+	allEnvActors.RemoveSingleSwap(envActor, false);
+	if (AMPGS* theGameState = GetAuthorityGameState()) theGameState->RemoveEntity(EEntityList::EEnvActor, envActor);
+}
+
+void UMPWorldRegistry::RegisterAIHumanController(AMPAIControllerHumanPlayer* aiController)
+{
+	if (aiController) allAIHumanControllers.AddUnique(aiController);
+}
+void UMPWorldRegistry::UnregisterAIHumanController(AMPAIControllerHumanPlayer* aiController)
+{
+	allAIHumanControllers.RemoveSingleSwap(aiController, false);
+}
+
+void UMPWorldRegistry::RegisterAIController(AMPAIController* aiController)
+{
+	if (aiController) allAIControllers.AddUnique(aiController);
+}
+void UMPWorldRegistry::UnregisterAIController(AMPAIController* aiController)
+{
+	allAIControllers.RemoveSingleSwap(aiController, false);
+}
+
+void UMPWorldRegistry::RegisterAISystemManager(AMPAISystemManager* manager)
+{
+	aiSystemManager = manager;
+}
+void UMPWorldRegistry::UnregisterAISystemManager(AMPAISystemManager* manager)
+{
+	if (aiSystemManager == manager) aiSystemManager = nullptr;
+}
+
+void UMPWorldRegistry::RegisterCharacter(AMPCharacter* character)
+{
+	if (character) allCharacters.AddUnique(character);
+	if (AMPGS* theGameState = GetAuthorityGameState())
+	{
+		if (Cast<AMPCharacterHuman>(character)) theGameState->AddEntity(EEntityList::EHuman, character);
+		else if (Cast<AMPCharacterCat>(character)) theGameState->AddEntity(EEntityList::ECat, character);
+	}
+}
+void UMPWorldRegistry::UnregisterCharacter(AMPCharacter* character)
+{
+	allCharacters.RemoveSingleSwap(character, false);
+	if (AMPGS* theGameState = GetAuthorityGameState())
+	{
+		if (Cast<AMPCharacterHuman>(character)) theGameState->RemoveEntity(EEntityList::EHuman, character);
+		else if (Cast<AMPCharacterCat>(character)) theGameState->RemoveEntity(EEntityList::ECat, character);
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This world subsystem is the registry of every gameplay actor that match and AI setup need to
+// find: items, environmental actors, human AI controllers and characters. Actors add themselves in
+// `BeginPlay` and remove themselves in `EndPlay`, so nobody has to scan the whole level with
+// `GetAllActorsOfClass`.
+//
+// How to utilize in Blueprint:
+// 1. Nothing to create or place. Unreal instantiates one registry per world automatically.
+// 2. Get it with `GetWorld()->GetSubsystem<UMPWorldRegistry>()` and iterate the typed lists (`GetItems`, `GetEnvActors`, ...).
+//
+// Necessary things to define:
+// - Nothing. Any new actor type that setup code needs to find should register itself here in the same way.
+//
+// How it interacts with other classes:
+// - AMPItem, AMPEnvActorComp, AMPAIController, AMPAIControllerHumanPlayer, AMPCharacter, AMPAISystemManager: Register on `BeginPlay` and unregister on `EndPlay`. Pooled items and env actors also unregister while parked in a factory pool, and register again when they are handed out.
+// - UManagerMatch: `SetupMapItems` / `SetupMapEnvActors` walk the item and env actor lists.
+// - AMPGS: On the server, humans, cats, items and env actors are mirrored into the replicated entity lists of the Game State as they register and unregister.
+// - AMPAISystemManager: `LocateAIHumans` / `LocateUrgentEnvActors` walk the AI human and env actor lists, and the AI budget walks every AI controller. AI controllers find the manager through `GetAISystemManager`.
+// - The getters return the internal arrays by const reference, so iterating them allocates nothing. Unregistering swaps the last entry into the freed slot; a loop that may eliminate the actor it is visiting must iterate backwards.
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MPWorldRegistry.generated.h"
+
+class AMPItem;
+class AMPEnvActorComp;
+class AMPAIControllerHumanPlayer;
+class AMPAIController;
+class AMPAISystemManager;
+class AMPCharacter;
+class AMPGS;
+
+UCLASS()
+class UMPWorldRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY()
+		TArray<AMPItem*> allItems;
+	UPROPERTY()
+		TArray<AMPEnvActorComp*> allEnvActors;
+	UPROPERTY()
+		TArray<AMPAIControllerHumanPlayer*> allAIHumanControllers;
+	UPROPERTY()
+		TArray<AMPCharacter*> allCharacters;
+	UPROPERTY()
+		TArray<AMPAIController*> allAIControllers;
+	UPROPERTY()
+		AMPAISystemManager* aiSystemManager = nullptr;
+
+	// null on clients, they receive the Game State lists through replication instead
+	AMPGS* GetAuthorityGameState() const;
+
+public:
+	virtual void Deinitialize() override;
+
+	void RegisterItem(AMPItem* item);
+	void UnregisterItem(AMPItem* item);
+	void RegisterEnvActor(AMPEnvActorComp* envActor);
+	void UnregisterEnvActor(AMPEnvActorComp* envActor);
+	void RegisterAIHumanController(AMPAIControllerHumanPlayer* aiController);
+	void UnregisterAIHumanController(AMPAIControllerHumanPlayer* aiController);
+	void RegisterCharacter(AMPCharacter* character);
+	void UnregisterCharacter(AMPCharacter* character);
+	void RegisterAIController(AMPAIController* aiController);
+	void UnregisterAIController(AMPAIController* aiController);
+	void RegisterAISystemManager(AMPAISystemManager* manager);
+	void UnregisterAISystemManager(AMPAISystemManager* manager);
+
+	const TArray<AMPItem*>& GetItems() const { return allItems; }
+	const TArray<AMPEnvActorComp*>& GetEnvActors() const { return allEnvActors; }
+	const TArray<AMPAIControllerHumanPlayer*>& GetAIHumanControllers() const { return allAIHumanControllers; }
+	const TArray<AMPCharacter*>& GetCharacters() const { return allCharacters; }
+	const TArray<AMPAIController*>& GetAIControllers() const { return allAIControllers; }
+	// null until the AI manager is spawned, and always on clients
+	AMPAISystemManager* GetAISystemManager() const { return aiSystemManager; }
+};
@@ -0,0 +1,350 @@
+#include "MPLogFileSink.h"
+
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+namespace
+{
+	// how long the writer sleeps when nobody wakes it up
+	constexpr uint32 WriterIdleWaitMs = 100;
+
+	const TCHAR* GetLevelTag(ELogLevel level)
+	{
+		switch (level)
+		{
+		case ELogLevel::Error: return TEXT("ERROR");
+		case ELogLevel::Warning: return TEXT("WARN");
+		case ELogLevel::Info: return TEXT("INFO");
+		case ELogLevel::Debug: return TEXT("DEBUG");
+		case ELogLevel::Verbose: return TEXT("VERBOSE");
+		default: return TEXT("UNKNOWN");
+		}
+	}
+
+	FString NameToString(FName name)
+	{
+		return name.IsNone() ? FString() : name.ToString();
+	}
+
+	void AppendUtf8(TArray<uint8>& buffer, const FString& text)
+	{
+		FTCHARToUTF8 utf8(*text);
+		buffer.Append(reinterpret_cast<const uint8*>(utf8.Get()), utf8.Length());
+	}
+
+	void AppendJsonString(TArray<uint8>& buffer, const FString& text)
+	{
+		FString escaped;
+		escaped.Reserve(text.Len() + 2);
+		escaped.AppendChar(TEXT('"'));
+		for (TCHAR character : text)
+		{
+			switch (character)
+			{
+			case TEXT('"'): escaped.Append(TEXT("\\\"")); break;
+			case TEXT('\\'): escaped.Append(TEXT("\\\\")); break;
+			case TEXT('\n'): escaped.Append(TEXT("\\n")); break;
+			case TEXT('\r'): escaped.Append(TEXT("\\r")); break;
+			case TEXT('\t'): escaped.Append(TEXT("\\t")); break;
+			default:
+				if (character < 0x20)
+				{
+					escaped.Appendf(TEXT("\\u%04x"), static_cast<uint32>(character));
+				}
+				else
+				{
+					escaped.AppendChar(character);
+				}
+				break;
+			}
+		}
+		escaped.AppendChar(TEXT('"'));
+		AppendUtf8(buffer, escaped);
+	}
+
+	template<typename T>
+	void AppendPod(TArray<uint8>& buffer, T value)
+	{
+		buffer.Append(reinterpret_cast<const uint8*>(&value), sizeof(T));
+	}
+
+	void AppendSizedUtf8(TArray<uint8>& buffer, const FString& text)
+	{
+		FTCHARToUTF8 utf8(*text);
+		AppendPod<uint32>(buffer, static_cast<uint32>(utf8.Length()));
+		buffer.Append(reinterpret_cast<const uint8*>(utf8.Get()), utf8.Length());
+	}
+}
+
+FMPLogFileSink::FMPLogFileSink(const FLogConfig& config)
+	: fileFormat(config.fileLogFormat)
+	, maxFileSizeBytes(FMath::Max(config.fileLogMaxSizeKB, 1) * 1024LL)
+	, maxRotatedFiles(FMath::Max(config.fileLogMaxRotatedFiles, 0))
+{
+	const uint64 capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(config.fileLogBufferLines, 2)));
+	slots = MakeUnique<FSlot[]>(capacity);
+	slotMask = capacity - 1;
+	for (uint64 index = 0; index < capacity; ++index)
+	{
+		slots[index].sequence.store(index, std::memory_order_relaxed);
+	}
+
+	logDirectory = FPaths::Combine(FPaths::ProjectLogDir(), TEXT("MatchLogs"));
+	baseFileName = TEXT("MatchLog");
+	fileExtension = fileFormat == ELogFileFormat::EBinary ? TEXT("mplog") : TEXT("jsonl");
+}
+
+FMPLogFileSink::~FMPLogFileSink()
+{
+	StopWriter();
+}
+
+bool FMPLogFileSink::StartWriter()
+{
+	if (writerThread) return true;
+
+	if (!OpenCurrentFile()) return false;
+
+	stopRequested.store(false);
+	wakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	writerThread = FRunnableThread::Create(this, TEXT("MPLogFileSink"), 0, TPri_BelowNormal);
+	return writerThread != nullptr;
+}
+
+void FMPLogFileSink::StopWriter()
+{
+	if (writerThread)
+	{
+		Stop();
+		writerThread->WaitForCompletion();
+		delete writerThread;
+		writerThread = nullptr;
+	}
+
+	if (wakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(wakeEvent);
+		wakeEvent = nullptr;
+	}
+
+	// the writer is gone, anything it left behind is flushed from here
+	DrainToFile();
+
+	delete fileHandle;
+	fileHandle = nullptr;
+}
+
+bool FMPLogFileSink::Enqueue(ELogLevel level, FString&& message, FName context, FName matchId)
+{
+	uint64 pos = enqueuePos.load(std::memory_order_relaxed);
+	FSlot* slot = nullptr;
+
+	// bounded multi-producer queue: claim a slot by advancing enqueuePos, never block
+	for (;;)
+	{
+		slot = &slots[pos & slotMask];
+		const uint64 sequence = slot->sequence.load(std::memory_order_acquire);
+		const int64 distance = static_cast<int64>(sequence) - static_cast<int64>(pos);
+
+		if (distance == 0)
+		{
+			if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (distance < 0)
+		{
+			droppedLines.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			pos = enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	slot->record.utcTicks = FDateTime::UtcNow().GetTicks();
+	slot->record.level = level;
+	slot->record.context = context;
+	slot->record.matchId = matchId;
+	slot->record.message = MoveTemp(message);
+	slot->sequence.store(pos + 1, std::memory_order_release);
+
+	// wake the writer once every half buffer of lines instead of on every line
+	if (wakeEvent && (((pos + 1) & (slotMask >> 1)) == 0))
+	{
+		wakeEvent->Trigger();
+	}
+	return true;
+}
+
+bool FMPLogFileSink::Dequeue(FMPLogRecord& outRecord)
+{
+	FSlot& slot = slots[dequeuePos & slotMask];
+	const uint64 sequence = slot.sequence.load(std::memory_order_acquire);
+
+	if (static_cast<int64>(sequence) - static_cast<int64>(dequeuePos + 1) < 0)
+	{
+		return false;
+	}
+
+	outRecord = MoveTemp(slot.record);
+	slot.sequence.store(dequeuePos + slotMask + 1, std::memory_order_release);
+	++dequeuePos;
+	return true;
+}
+
+uint32 FMPLogFileSink::Run()
+{
+	while (!stopRequested.load())
+	{
+		wakeEvent->Wait(WriterIdleWaitMs);
+		DrainToFile();
+	}
+	return 0;
+}
+
+void FMPLogFileSink::Stop()
+{
+	stopRequested.store(true);
+	if (wakeEvent)
+	{
+		wakeEvent->Trigger();
+	}
+}
+
+void FMPLogFileSink::DrainToFile()
+{
+	if (!fileHandle) return;
+
+	const uint64 dropped = droppedLines.load(std::memory_order_relaxed);
+	if (dropped != reportedDroppedLines)
+	{
+		FMPLogRecord dropRecord;
+		dropRecord.utcTicks = FDateTime::UtcNow().GetTicks();
+		dropRecord.level = ELogLevel::Warning;
+		dropRecord.context = FName(TEXT("MPLogFileSink"));
+		dropRecord.message = FString::Printf(TEXT("Log buffer full, dropped %llu lines (%llu total)"), dropped - reportedDroppedLines, dropped);
+		reportedDroppedLines = dropped;
+		AppendRecord(dropRecord);
+	}
+
+	FMPLogRecord record;
+	while (Dequeue(record))
+	{
+		AppendRecord(record);
+		writtenLines.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	FlushWriteBuffer();
+}
+
+void FMPLogFileSink::AppendRecord(const FMPLogRecord& record)
+{
+	if (fileFormat == ELogFileFormat::EBinary)
+	{
+		AppendBinaryRecord(record);
+	}
+	else
+	{
+		AppendJsonLine(record);
+	}
+}
+
+void FMPLogFileSink::AppendJsonLine(const FMPLogRecord& record)
+{
+	AppendUtf8(writeBuffer, FString::Printf(TEXT("{\"ts\":\"%s\",\"level\":\"%s\",\"ctx\":"),
+		*FDateTime(record.utcTicks).ToIso8601(), GetLevelTag(record.level)));
+	AppendJsonString(writeBuffer, NameToString(record.context));
+	AppendUtf8(writeBuffer, TEXT(",\"match\":"));
+	AppendJsonString(writeBuffer, NameToString(record.matchId));
+	AppendUtf8(writeBuffer, TEXT(",\"msg\":"));
+	AppendJsonString(writeBuffer, record.message);
+	AppendUtf8(writeBuffer, TEXT("}\n"));
+}
+
+void FMPLogFileSink::AppendBinaryRecord(const FMPLogRecord& record)
+{
+	const int32 sizeOffset = writeBuffer.Num();
+	AppendPod<uint32>(writeBuffer, 0);
+	AppendPod<int64>(writeBuffer, record.utcTicks);
+	AppendPod<uint8>(writeBuffer, static_cast<uint8>(record.level));
+	AppendSizedUtf8(writeBuffer, NameToString(record.context));
+	AppendSizedUtf8(writeBuffer, NameToString(record.matchId));
+	AppendSizedUtf8(writeBuffer, record.message);
+
+	const uint32 recordSize = static_cast<uint32>(writeBuffer.Num() - sizeOffset - sizeof(uint32));
+	FMemory::Memcpy(writeBuffer.GetData() + sizeOffset, &recordSize, sizeof(uint32));
+}
+
+void FMPLogFileSink::FlushWriteBuffer()
+{
+	if (!fileHandle || writeBuffer.Num() == 0) return;
+
+	if (fileSize > 0 && fileSize + writeBuffer.Num() > maxFileSizeBytes)
+	{
+		RotateFiles();
+		if (!fileHandle)
+		{
+			writeBuffer.Reset();
+			return;
+		}
+	}
+
+	fileHandle->Write(writeBuffer.GetData(), writeBuffer.Num());
+	fileHandle->Flush();
+	fileSize += writeBuffer.Num();
+	writeBuffer.Reset();
+}
+
+FString FMPLogFileSink::GetFilePath(int32 rotationIndex) const
+{
+	const FString fileName = rotationIndex == 0
+		? FString::Printf(TEXT("%s.%s"), *baseFileName, *fileExtension)
+		: FString::Printf(TEXT("%s.%d.%s"), *baseFileName, rotationIndex, *fileExtension);
+	return FPaths::Combine(logDirectory, fileName);
+}
+
+bool FMPLogFileSink::OpenCurrentFile()
+{
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	platformFile.CreateDirectoryTree(*logDirectory);
+
+	const FString filePath = GetFilePath(0);
+	fileHandle = platformFile.OpenWrite(*filePath, true, true);
+	fileSize = fileHandle ? fileHandle->Size() : 0;
+	return fileHandle != nullptr;
+}
+
+void FMPLogFileSink::RotateFiles()
+{
+	delete fileHandle;
+	fileHandle = nullptr;
+
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	if (maxRotatedFiles > 0)
+	{
+		platformFile.DeleteFile(*GetFilePath(maxRotatedFiles));
+		for (int32 rotationIndex = maxRotatedFiles - 1; rotationIndex >= 0; --rotationIndex)
+		{
+			const FString fromPath = GetFilePath(rotationIndex);
+			if (platformFile.FileExists(*fromPath))
+			{
+				platformFile.MoveFile(*GetFilePath(rotationIndex + 1), *fromPath);
+			}
+		}
+	}
+	else
+	{
+		platformFile.DeleteFile(*GetFilePath(0));
+	}
+
+	OpenCurrentFile();
+}
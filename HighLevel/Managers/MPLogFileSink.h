@@ -0,0 +1,108 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This is the file output of `UManagerLog`. It is a plain C++ class (not a UObject) that owns a
+// lock-free ring buffer and a background writer thread. The game thread only moves a record into
+// the ring buffer (the message string is moved, context and match id are names); formatting, file IO and file rotation all happen on the writer thread, so a slow
+// disk never stalls a frame.
+//
+// How to utilize in Blueprint:
+// - It is not exposed to Blueprint. Turn on `enableFileLogging` in the `FLogConfig` passed to `UManagerLog::SetLogConfig`; dedicated servers (or any build started with `-MPFileLog`) turn it on by themselves.
+//
+// Necessary things to define:
+// - Nothing. Files go to `<Project>/Saved/Logs/MatchLogs/`. `MatchLog.jsonl` (or `MatchLog.mplog` in binary mode) is the current file, `MatchLog.1.jsonl` the previous one, and so on up to `fileLogMaxRotatedFiles`.
+//
+// How it interacts with other classes:
+// - UManagerLog: Creates and destroys the sink, and calls `Enqueue` for every message that passed the level filter.
+// - FLogConfig: Chooses the format (JSON lines or binary), the ring buffer size and the rotation limits.
+// - Records carry the UTC timestamp, level, context, match id and message. When the ring buffer is full the line is dropped and counted; the writer notes every drop in the file itself, and `UManagerLog::GetFileLogCounters` reports the totals.
+//
+// Binary record layout (little endian): uint32 recordSize, int64 utcTicks, uint8 level, then context, match id and message, each as uint32 byteCount + UTF-8 bytes.
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "../../CommonStruct.h"
+
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+class IFileHandle;
+
+struct FMPLogRecord
+{
+	int64 utcTicks = 0;
+	ELogLevel level = ELogLevel::None;
+	FName context;
+	FName matchId;
+	FString message;
+};
+
+class FMPLogFileSink : public FRunnable
+{
+public:
+	explicit FMPLogFileSink(const FLogConfig& config);
+	virtual ~FMPLogFileSink();
+
+	bool StartWriter();
+	void StopWriter();
+
+	// any thread, returns false (and counts a drop) when the ring buffer is full
+	// the message is moved into the slot and the names are plain copies, nothing is allocated here
+	bool Enqueue(ELogLevel level, FString&& message, FName context, FName matchId);
+
+	uint64 GetWrittenLines() const { return writtenLines.load(std::memory_order_relaxed); }
+	uint64 GetDroppedLines() const { return droppedLines.load(std::memory_order_relaxed); }
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+// ring buffer
+private:
+	struct FSlot
+	{
+		std::atomic<uint64> sequence { 0 };
+		FMPLogRecord record;
+	};
+
+	TUniquePtr<FSlot[]> slots;
+	uint64 slotMask = 0;
+	std::atomic<uint64> enqueuePos { 0 };
+	uint64 dequeuePos = 0; // writer thread only
+
+	bool Dequeue(FMPLogRecord& outRecord);
+
+// writer
+private:
+	ELogFileFormat fileFormat;
+	int64 maxFileSizeBytes;
+	int32 maxRotatedFiles;
+
+	FString logDirectory;
+	FString baseFileName;
+	FString fileExtension;
+
+	IFileHandle* fileHandle = nullptr;
+	int64 fileSize = 0;
+	TArray<uint8> writeBuffer;
+
+	FRunnableThread* writerThread = nullptr;
+	FEvent* wakeEvent = nullptr;
+	std::atomic<bool> stopRequested { false };
+
+	std::atomic<uint64> writtenLines { 0 };
+	std::atomic<uint64> droppedLines { 0 };
+	uint64 reportedDroppedLines = 0;
+
+	void DrainToFile();
+	void AppendRecord(const FMPLogRecord& record);
+	void AppendJsonLine(const FMPLogRecord& record);
+	void AppendBinaryRecord(const FMPLogRecord& record);
+	void FlushWriteBuffer();
+
+	FString GetFilePath(int32 rotationIndex) const;
+	bool OpenCurrentFile();
+	void RotateFiles();
+};
@@ -41,12 +41,12 @@ bool UManagerAIController::AddBot(ETeam team)
     if (team == ETeam::EHuman)
     {
         AllAIHumans.Add(NewAI);
-        UManagerLog::LogInfo(FString::Printf(TEXT("Added human bot. Total human AIs: %d"), AllAIHumans.Num()), TEXT("ManagerAIController"));
+        MP_LOG_INFO(TEXT("ManagerAIController"), TEXT("Added human bot. Total human AIs: %d"), AllAIHumans.Num());
     }
     else if (team == ETeam::ECat)
     {
         AllAICats.Add(NewAI);
-        UManagerLog::LogInfo(FString::Printf(TEXT("Added cat bot. Total cat AIs: %d"), AllAICats.Num()), TEXT("ManagerAIController"));
+        MP_LOG_INFO(TEXT("ManagerAIController"), TEXT("Added cat bot. Total cat AIs: %d"), AllAICats.Num());
     }
     return true;
 }
@@ -65,7 +65,7 @@ bool UManagerAIController::RemoveBot(int32 playerIndex)
         }
         AllAIHumans.RemoveAt(playerIndex);
         Removed = true;
-        UManagerLog::LogInfo(FString::Printf(TEXT("Removed human bot idx %d"), playerIndex), TEXT("ManagerAIController"));
+        MP_LOG_INFO(TEXT("ManagerAIController"), TEXT("Removed human bot idx %d"), playerIndex);
     }
     else
     {
@@ -79,13 +79,13 @@ bool UManagerAIController::RemoveBot(int32 playerIndex)
             }
             AllAICats.RemoveAt(CatIndex);
             Removed = true;
-            UManagerLog::LogInfo(FString::Printf(TEXT("Removed cat bot idx %d"), CatIndex), TEXT("ManagerAIController"));
+            MP_LOG_INFO(TEXT("ManagerAIController"), TEXT("Removed cat bot idx %d"), CatIndex);
         }
     }
 
     if (!Removed)
     {
-        UManagerLog::LogWarning(FString::Printf(TEXT("Bot idx %d not found"), playerIndex), TEXT("ManagerAIController"));
+        MP_LOG_WARNING(TEXT("ManagerAIController"), TEXT("Bot idx %d not found"), playerIndex);
     }
     return Removed;
 }
@@ -141,10 +141,23 @@ void UManagerAIController::SpawnLobbyAIs()
     }
 }
 
-void UManagerAIController::AddGlobalSearchTask(const FVector& NoiseLocation)
+void UManagerAIController::AddGlobalSearchTask(const FVector& NoiseLocation, float Weight)
 {
+    // a noise next to one that is still waiting makes that search more important instead of adding another
+    for (FGlobalAITask& Task : PendingTasks)
+    {
+        if (FVector::DistSquared(Task.Location, NoiseLocation) <= FMath::Square(GlobalTaskMergeRadius))
+        {
+            Task.Location = (Task.Location * Task.Weight + NoiseLocation * Weight) / (Task.Weight + Weight);
+            Task.Weight += Weight;
+            AssignGlobalTasks();
+            return;
+        }
+    }
+
     FGlobalAITask NewTask;
     NewTask.Location = NoiseLocation;
+    NewTask.Weight = Weight;
     PendingTasks.Add(NewTask);
 
     AssignGlobalTasks();
@@ -152,6 +165,8 @@ void UManagerAIController::AddGlobalSearchTask(const FVector& NoiseLocation)
 
 void UManagerAIController::AssignGlobalTasks()
 {
+    PendingTasks.StableSort([](const FGlobalAITask& A, const FGlobalAITask& B){ return A.Weight > B.Weight; });
+
     for (FGlobalAITask& Task : PendingTasks)
     {
         if (Task.bAssigned) continue;
@@ -159,15 +174,13 @@ void UManagerAIController::AssignGlobalTasks()
         // Find first idle human AI
         for (AMPAIController* Ctrl : AllAIHumans)
         {
-            if (!Ctrl) continue;
-            UBlackboardComponent* BB = Ctrl->GetBB();
-            if (!BB) continue;
+            AMPAIControllerHumanPlayer* HumanCtrl = Cast<AMPAIControllerHumanPlayer>(Ctrl);
+            if (!HumanCtrl || !HumanCtrl->GetBB()) continue;
 
-            uint8 CurState = BB->GetValueAsEnum(TEXT("State"));
+            uint8 CurState = HumanCtrl->GetBBState();
             if (CurState == static_cast<uint8>(EAIHumanState::Idle) || CurState == static_cast<uint8>(EAIHumanState::Wander))
             {
-                BB->SetValueAsVector(TEXT("NoiseLocation"), Task.Location);
-                BB->SetValueAsEnum(TEXT("State"), static_cast<uint8>(EAIHumanState::Search));
+                HumanCtrl->StartNoiseSearch(Task.Location);
                 Task.bAssigned = true;
                 break;
             }
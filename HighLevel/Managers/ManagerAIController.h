@@ -11,7 +11,7 @@
 // 2. From a lobby or settings menu, you would get the instance of this manager from the Game Mode and call `SetNumAICats` and `SetNumAIHumans` to configure the number of bots for the upcoming match.
 // 3. The Game Mode is responsible for calling `SetupAIManager` when the match is being initialized.
 // 4. When the match starts, the Game Mode calls `SpawnLobbyAIs` to create the actual pawns and controllers for the configured number of bots.
-// 5. During gameplay, other systems can add global tasks. For example, if a loud noise happens, that system can call `AddGlobalSearchTask` on this manager to have an AI investigate the location.
+// 5. During gameplay, other systems can add global tasks. For example, if a loud noise happens, that system can call `AddGlobalSearchTask` on this manager to have an AI investigate the location. A task within `GlobalTaskMergeRadius` of a pending one adds its weight to that task, and the heaviest tasks are assigned first. `UMPNoiseAggregator` adds one task per heavy noise cluster.
 //
 // Necessary things to define:
 // - This manager's properties are configured at runtime, primarily through the `SetNumAI...` functions. It does not require pre-set assets in the Blueprint editor.
@@ -49,9 +49,12 @@ protected:
     struct FGlobalAITask
     {
         FVector Location;
+        float Weight = 1.0f;
         bool bAssigned = false;
     };
 
+    float GlobalTaskMergeRadius = 600.0f;
+
     TArray<FGlobalAITask> PendingTasks;
 
     UPROPERTY()
@@ -80,7 +83,7 @@ public:
 
     // --- Global task handling ---
     UFUNCTION(BlueprintCallable, Category="AI Manager")
-    void AddGlobalSearchTask(const FVector& NoiseLocation);
+    void AddGlobalSearchTask(const FVector& NoiseLocation, float Weight = 1.0f);
 
     // Iterate over pending tasks and assign to available AI
     void AssignGlobalTasks();
@@ -3,9 +3,9 @@
 
 #include "../MPGMGameplay.h"
 #include "../Managers/ManagerLog.h"
+#include "../Managers/ManagerAIController.h"
+#include "../Managers/ManagerMatchClock.h"
 #include "../MPGS.h"
-#include "../../MPActor/Player/Widget/HUDLobbyManager.h"
-#include "../../MPActor/Player/Widget/HUDLobby.h"
 #include "../../MPActor/Player/MPControllerPlayer.h"
 #include "../../MPActor/Player/MPPlayerState.h"
 
@@ -17,7 +17,7 @@ void UManagerLobby::StartLobby()
     // Log debug mode status
     if (gameMode->GetSinglePlayerDebugMode() || gameMode->GetMultiplayerDebugMode())
     {
-        UManagerLog::LogInfo(FString::Printf(TEXT("Debug mode status: %s"), *gameMode->GetDebugModeStatus()), TEXT("MPGMGameplay"));
+        MP_LOG_INFO(TEXT("MPGMGameplay"), TEXT("Debug mode status: %s"), *gameMode->GetDebugModeStatus());
     }
 
     // Auto-assign teams for any unassigned players
@@ -31,6 +31,7 @@ void UManagerLobby::StartLobby()
             eachPlayer->LobbyStartUpdate();
         }
     }
+    SyncLobbyRoster();
 }
 
 bool UManagerLobby::CheckReadyToStartGame() const
@@ -111,10 +112,10 @@ bool UManagerLobby::AssignPlayerToTeam(AMPControllerPlayer* player, ETeam team)
     if (currentTeamCount <= otherTeamCount + 1)
     {
         playerState->playerTeam = team;
-        UManagerLog::LogInfo(FString::Printf(TEXT("Player %s assigned to %s team"), *playerState->playerName, team == ETeam::EHuman ? TEXT("Human") : TEXT("Cat")), TEXT("MPGMGameplay"));
+        MP_LOG_INFO(TEXT("MPGMGameplay"), TEXT("Player %s assigned to %s team"), *playerState->playerName, team == ETeam::EHuman ? TEXT("Human") : TEXT("Cat"));
         return true;
     }
-    UManagerLog::LogWarning(FString::Printf(TEXT("Cannot assign player to %s team - teams would be unbalanced"), team == ETeam::EHuman ? TEXT("Human") : TEXT("Cat")), TEXT("MPGMGameplay"));
+    MP_LOG_WARNING(TEXT("MPGMGameplay"), TEXT("Cannot assign player to %s team - teams would be unbalanced"), team == ETeam::EHuman ? TEXT("Human") : TEXT("Cat"));
     return false;
 }
 
@@ -130,10 +131,11 @@ bool UManagerLobby::SwitchPlayerTeam(AMPControllerPlayer* player, ETeam newTeam)
     if (newTeamCount < currentTeamCount || newTeamCount <= currentTeamCount + 1)
     {
         playerState->playerTeam = newTeam;
-        UManagerLog::LogInfo(FString::Printf(TEXT("Player %s switched from %s to %s team"), *playerState->playerName, currentTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat"), newTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat")), TEXT("MPGMGameplay"));
+        MP_LOG_INFO(TEXT("MPGMGameplay"), TEXT("Player %s switched from %s to %s team"), *playerState->playerName, currentTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat"), newTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat"));
+        SyncLobbyRoster();
         return true;
     }
-    UManagerLog::LogWarning(FString::Printf(TEXT("Cannot switch player to %s team - would unbalance teams"), newTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat")), TEXT("MPGMGameplay"));
+    MP_LOG_WARNING(TEXT("MPGMGameplay"), TEXT("Cannot switch player to %s team - would unbalance teams"), newTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat"));
     return false;
 }
 
@@ -155,7 +157,7 @@ void UManagerLobby::AutoAssignTeams()
         ETeam targetTeam = (humanCount <= catCount) ? ETeam::EHuman : ETeam::ECat;
         AssignPlayerToTeam(player, targetTeam);
     }
-    UManagerLog::LogInfo(FString::Printf(TEXT("Auto-assigned %d players to teams"), unassignedPlayers.Num()), TEXT("MPGMGameplay"));
+    MP_LOG_INFO(TEXT("MPGMGameplay"), TEXT("Auto-assigned %d players to teams"), unassignedPlayers.Num());
 }
 
 int UManagerLobby::GetTeamPlayerCount(ETeam team) const
@@ -172,31 +174,33 @@ int UManagerLobby::GetTeamPlayerCount(ETeam team) const
     return count;
 }
 
+void UManagerLobby::StartReadyCountdown()
+{
+    if (!gameMode || !gameMode->GetGameState() || !gameMode->GetManagerMatchClock()) return;
+
+    // a player toggling ready while the countdown runs must not restart it
+    if (gameMode->GetManagerMatchClock()->IsPhaseRunning(EGPStatus::ELobby)) return;
+
+    gameMode->GetGameState()->SetMostPlayerReady(true);
+    gameMode->GetManagerMatchClock()->StartPhase(EGPStatus::ELobby, gameMode->GetGameState()->readyTotalTime);
+    MP_LOG_INFO(TEXT("MPGMGameplay"), TEXT("Lobby: Countdown STARTED - %d seconds"), gameMode->GetGameState()->readyTotalTime);
+}
+
 void UManagerLobby::CountdownReadyGame()
 {
     if (!CheckReadyToStartGame())
     {
-        gameMode->GetGameState()->isMostPlayerReady = false;
-        if (gameMode->GetWorld())
+        gameMode->GetGameState()->SetMostPlayerReady(false);
+        if (gameMode->GetManagerMatchClock())
         {
-            gameMode->GetWorld()->GetTimerManager().ClearTimer(readyTimerHandle);
+            gameMode->GetManagerMatchClock()->StopPhase();
         }
         UManagerLog::LogInfo(TEXT("Lobby: Countdown CANCELLED - conditions no longer met"), TEXT("MPGMGameplay"));
         return;
     }
     if (gameMode->GetGameState()->curReadyTime > 0)
     {
-        UWorld* serverWorld = gameMode->GetWorld();
-        if (serverWorld)
-        {
-            gameMode->GetGameState()->curReadyTime -= 1;
-            ClientUpdateReadyCountdown(gameMode->GetGameState()->curReadyTime);
-            UManagerLog::LogInfo(FString::Printf(TEXT("Lobby: Countdown %d seconds remaining"), gameMode->GetGameState()->curReadyTime), TEXT("MPGMGameplay"));
-            serverWorld->GetTimerManager().ClearTimer(readyTimerHandle);
-            FTimerDelegate readyTimerDel;
-            readyTimerDel.BindUFunction(gameMode, FName("CountdownReadyGame"));
-            serverWorld->GetTimerManager().SetTimer(readyTimerHandle, readyTimerDel, 1, false);
-        }
+        MP_LOG_DEBUG(TEXT("MPGMGameplay"), TEXT("Lobby: Countdown %d seconds remaining"), gameMode->GetGameState()->curReadyTime);
     }
     else
     {
@@ -231,59 +235,67 @@ bool UManagerLobby::SetPlayerReady(AMPControllerPlayer* player, bool isReady)
         return false;
     }
     playerState->isPlayerReady = isReady;
-    UManagerLog::LogInfo(FString::Printf(TEXT("Player %s ready state set to: %s"), *playerState->playerName, isReady ? TEXT("Ready") : TEXT("Not Ready")), TEXT("MPGMGameplay"));
+    MP_LOG_INFO(TEXT("MPGMGameplay"), TEXT("Player %s ready state set to: %s"), *playerState->playerName, isReady ? TEXT("Ready") : TEXT("Not Ready"));
     if (isReady && CheckReadyToStartGame())
     {
         UManagerLog::LogInfo(TEXT("All requirements met! Starting game..."), TEXT("MPGMGameplay"));
-        CountdownReadyGame();
+        StartReadyCountdown();
     }
-    BroadcastPlayerListUpdate();
+    SyncLobbyRoster();
     return true;
 }
 
-void UManagerLobby::BroadcastPlayerListUpdate()
+void UManagerLobby::SyncLobbyRoster()
 {
-    UManagerLog::LogDebug(TEXT("Broadcasting player list update to all clients"), TEXT("MPGMGameplay"));
-    ClientUpdateLobbyHUDs();
-}
+    AMPGS* gameState = gameMode ? gameMode->GetGameState() : nullptr;
+    if (!gameState) return;
 
-void UManagerLobby::ClientUpdateLobbyHUDs_Implementation()
-{
-    UManagerLog::LogDebug(TEXT("Client received lobby update request"), TEXT("MPGMGameplay"));
+    TArray<FMPLobbyEntry> desiredEntries;
     for (AMPControllerPlayer* eachPlayer : gameMode->GetAllPlayerControllers())
     {
-        if (eachPlayer && eachPlayer->GetManagerLobbyHUD() && eachPlayer->GetManagerLobbyHUD()->lobbyHUD)
-        {
-            eachPlayer->GetManagerLobbyHUD()->lobbyHUD->UpdatePlayerLists();
-        }
-        else if (eachPlayer && !eachPlayer->GetManagerLobbyHUD())
-        {
-            UManagerLog::LogWarning(FString::Printf(TEXT("Player %s has no lobby manager HUD for update"), *eachPlayer->GetName()), TEXT("MPGMGameplay"));
-        }
-        else if (eachPlayer && eachPlayer->GetManagerLobbyHUD() && !eachPlayer->GetManagerLobbyHUD()->lobbyHUD)
-        {
-            UManagerLog::LogWarning(FString::Printf(TEXT("Player %s lobby manager has no lobby HUD for update"), *eachPlayer->GetName()), TEXT("MPGMGameplay"));
-        }
+        AMPPlayerState* eachPlayerState = eachPlayer ? Cast<AMPPlayerState>(eachPlayer->PlayerState) : nullptr;
+        if (!eachPlayerState) continue;
+
+        FMPLobbyEntry& entry = desiredEntries.AddDefaulted_GetRef();
+        entry.playerName = eachPlayerState->playerName;
+        entry.team = eachPlayerState->playerTeam;
+        entry.isReady = eachPlayerState->isPlayerReady;
+        entry.playerIndex = eachPlayerState->playerIndex;
+        entry.playerState = eachPlayerState;
     }
-} 
 
-// Countdown update RPCs
-void UManagerLobby::ClientUpdateReadyCountdown_Implementation(int32 secondsRemaining)
-{
-    for (AMPControllerPlayer* eachPlayer : gameMode->GetAllPlayerControllers())
+    // bot indices run over the human bots first, then the cat bots, as RemoveBot expects
+    if (UManagerAIController* managerAIController = gameMode->GetManagerAIController())
     {
-        if (eachPlayer)
+        const TArray<AMPAIController*> humanAIs = managerAIController->GetAllAIHumans();
+        const TArray<AMPAIController*> catAIs = managerAIController->GetAllAICats();
+        auto addBotEntries = [&desiredEntries](const TArray<AMPAIController*>& bots, ETeam team, const TCHAR* namePrefix, int32 indexOffset)
         {
-            eachPlayer->UpdateLobbyHUDCountdownText(secondsRemaining);
-        }
+            for (int32 index = 0; index < bots.Num(); ++index)
+            {
+                if (!bots[index]) continue;
+
+                FMPLobbyEntry& entry = desiredEntries.AddDefaulted_GetRef();
+                entry.playerName = FString::Printf(TEXT("%s %d"), namePrefix, index + 1);
+                entry.team = team;
+                entry.isReady = false;
+                entry.isBot = true;
+                entry.playerIndex = indexOffset + index;
+                entry.botController = bots[index];
+            }
+        };
+        addBotEntries(humanAIs, ETeam::EHuman, TEXT("Human Bot"), 0);
+        addBotEntries(catAIs, ETeam::ECat, TEXT("Cat Bot"), humanAIs.Num());
     }
+
+    gameState->SyncLobbyRoster(desiredEntries);
+    MP_LOG_DEBUG(TEXT("MPGMGameplay"), TEXT("Lobby roster synced: %d entries"), desiredEntries.Num());
 }
 
 void UManagerLobby::ClearAllTimers()
 {
     if (gameMode->GetWorld())
     {
-        gameMode->GetWorld()->GetTimerManager().ClearTimer(readyTimerHandle);
         gameMode->GetWorld()->GetTimerManager().ClearTimer(restartLobbyTimerHandle);
     }
 }
\ No newline at end of file
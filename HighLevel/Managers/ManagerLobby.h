@@ -19,7 +19,9 @@
 // - UManagerMP: Inherits from the base manager class.
 // - AMPGMGameplay: The Game Mode owns this manager and is the main entry point for the UI to access it. The Game Mode will also call `StartLobby` when the lobby state begins and will initiate the match start when this manager determines everyone is ready.
 // - AMPControllerPlayer: This manager directly manipulates player controllers to set their ready status and team affiliation. It also uses them as keys to identify players.
-// - HUDLobby / Lobby UI: The UI is the primary driver of this manager's functions. It calls functions based on player input (clicking buttons) and listens for updates from the manager (like `ClientUpdateLobbyHUDs` and `ClientUpdateReadyCountdown`) to refresh the display.
+// - HUDLobby / Lobby UI: The UI is the primary driver of this manager's functions. It calls functions based on player input (clicking buttons). It does not hear from this manager directly. Every change here ends in `SyncLobbyRoster`, which updates the replicated `lobbyRoster` in `AMPGS`. The HUD patches the one entry named by each resulting `OnLobbyEvent`. The ready countdown text is refreshed locally from the replicated match clock in `AMPGS`.
+// - UManagerAIController: `SyncLobbyRoster` lists its human and cat bots as roster entries ("Human Bot 1", "Cat Bot 1", ...).
+// - UManagerMatchClock: `StartReadyCountdown` runs the ready countdown on the shared match clock, which calls `CountdownReadyGame` once per second.
 // - ETeam (Enum): Used extensively to manage team assignments and player counts.
 
 #include "CoreMinimal.h"
@@ -35,7 +37,6 @@ class UManagerLobby : public UManagerMP
 {
     GENERATED_BODY()
 protected:
-    FTimerHandle readyTimerHandle;
 	FTimerHandle restartLobbyTimerHandle;
 
 public:
@@ -49,14 +50,12 @@ public:
     bool SwitchPlayerTeam(AMPControllerPlayer* player, ETeam newTeam);
     void AutoAssignTeams();
     int GetTeamPlayerCount(ETeam team) const;
+    void StartReadyCountdown();
+    // per-second tick from UManagerMatchClock
     void CountdownReadyGame();
     void EndReadyTime();
-    void BroadcastPlayerListUpdate();
-
-    UFUNCTION(Client, Reliable)
-    void ClientUpdateLobbyHUDs();
-    UFUNCTION(Client, Reliable)
-    void ClientUpdateReadyCountdown(int32 secondsRemaining);
+    // server only, brings AMPGS::lobbyRoster in line with the current players and bots; only changed entries replicate
+    void SyncLobbyRoster();
 
     UFUNCTION(BlueprintCallable, Category = "Lobby")
     void ClearAllTimers();
@@ -14,17 +14,21 @@ UManagerLocalization::UManagerLocalization()
 {
     currentLanguage = ELanguage::EEnglish;
     defaultText = FText::FromString(TEXT("TEXT_NOT_FOUND"));
+
+    languageTables.SetNum(static_cast<int32>(ELanguage::Max));
+    currentTable = GetTable(currentLanguage);
 }
 
 void UManagerLocalization::InitializeLocalization()
 {
 	// Set default language
 	currentLanguage = ELanguage::EEnglish;
+	currentTable = GetTable(currentLanguage);
 	
 	// Load text data
 	LoadTextData();
 	
-	UManagerLog::LogInfo(FString::Printf(TEXT("Initialized with %d text entries"), cachedTextData.Num()), TEXT("ManagerLocalization"));
+	MP_LOG_INFO(TEXT("ManagerLocalization"), TEXT("Initialized with %d text entries"), textHandles.Num());
 }
 
 FText UManagerLocalization::GetLocalizedText(const FString& textKey) const
@@ -34,41 +38,67 @@ FText UManagerLocalization::GetLocalizedText(const FString& textKey) const
 
 FText UManagerLocalization::GetLocalizedTextForLanguage(const FString& textKey, ELanguage language) const
 {
-	// Check if we have cached data for this key and language
-	FString cacheKey = FString::Printf(TEXT("%s_%d"), *textKey, static_cast<int32>(language));
-	
-	if (const FText* cachedText = cachedTextData.Find(cacheKey))
-	{
-		return *cachedText;
-	}
-	
-	// If not found in cache, try to get from data table
-	if (textDataTable)
+	// FNAME_Find never adds to the name table, an unknown key simply misses
+	const int32 textHandle = FindTextHandle(FName(*textKey, FNAME_Find));
+	if (textHandle != INDEX_NONE)
 	{
-		// Try to find the text entry in the data table
-		FLocalizedText* textEntry = textDataTable->FindRow<FLocalizedText>(FName(*textKey), TEXT(""));
-		if (textEntry)
-		{
-			FText result = textEntry->GetLocalizedText(language);
-			
-			// Cache the result for future use
-			const_cast<UManagerLocalization*>(this)->cachedTextData.Add(cacheKey, result);
-			
-			return result;
-		}
+		return GetLocalizedTextByHandleForLanguage(textHandle, language);
 	}
 	
 	// If not found, log warning and return the key as fallback
-	UManagerLog::LogWarning(FString::Printf(TEXT("Text key '%s' not found for language %d"), *textKey, (int32)language), TEXT("ManagerLocalization"));
+	MP_LOG_WARNING(TEXT("ManagerLocalization"), TEXT("Text key '%s' not found for language %d"), *textKey, (int32)language);
 	return FText::FromString(textKey);
 }
 
+int32 UManagerLocalization::FindTextHandle(FName textKey) const
+{
+	if (textKey.IsNone()) return INDEX_NONE;
+
+	const int32* textHandle = textHandles.Find(textKey);
+	return textHandle ? *textHandle : INDEX_NONE;
+}
+
+FText UManagerLocalization::GetLocalizedTextByHandle(int32 textHandle) const
+{
+	if (currentTable && currentTable->texts.IsValidIndex(textHandle))
+	{
+		return currentTable->texts[textHandle];
+	}
+	return defaultText;
+}
+
+FText UManagerLocalization::GetLocalizedTextByHandleForLanguage(int32 textHandle, ELanguage language) const
+{
+	const FLocalizedTextTable* table = GetTable(language);
+	if (table && table->texts.IsValidIndex(textHandle))
+	{
+		return table->texts[textHandle];
+	}
+	return defaultText;
+}
+
+FText UManagerLocalization::GetLocalizedTextByHandleOrKey(int32 textHandle, const FString& textKey) const
+{
+	if (textHandle != INDEX_NONE)
+	{
+		return GetLocalizedTextByHandle(textHandle);
+	}
+	return GetLocalizedText(textKey);
+}
+
+const FLocalizedTextTable* UManagerLocalization::GetTable(ELanguage language) const
+{
+	const int32 languageIndex = static_cast<int32>(language);
+	return languageTables.IsValidIndex(languageIndex) ? &languageTables[languageIndex] : nullptr;
+}
+
 void UManagerLocalization::SetCurrentLanguage(ELanguage newLanguage)
 {
 	if (currentLanguage != newLanguage)
 	{
 		currentLanguage = newLanguage;
-		UManagerLog::LogInfo(FString::Printf(TEXT("Language changed to %d"), (int32)newLanguage), TEXT("ManagerLocalization"));
+		currentTable = GetTable(currentLanguage);
+		MP_LOG_INFO(TEXT("ManagerLocalization"), TEXT("Language changed to %d"), (int32)newLanguage);
 		
 		// Notify all subscribers of the language change
 		RefreshAllUIText();
@@ -77,7 +107,7 @@ void UManagerLocalization::SetCurrentLanguage(ELanguage newLanguage)
 
 void UManagerLocalization::RefreshAllUIText()
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Refreshing all UI text - Language changed to %d"), (int32)currentLanguage), TEXT("ManagerLocalization"));
+	MP_LOG_INFO(TEXT("ManagerLocalization"), TEXT("Refreshing all UI text - Language changed to %d"), (int32)currentLanguage);
 	
 	// Broadcast the language change event to all subscribers
 	OnLanguageChanged.Broadcast();
@@ -85,19 +115,7 @@ void UManagerLocalization::RefreshAllUIText()
 
 bool UManagerLocalization::HasTextKey(const FString& textKey) const
 {
-    // Check cached data first
-    if (cachedTextData.Contains(textKey))
-    {
-        return true;
-    }
-
-    // Check data table
-    if (textDataTable)
-    {
-        return textDataTable->FindRow<FLocalizedText>(FName(*textKey), TEXT("HasTextKey")) != nullptr;
-    }
-
-    return false;
+    return FindTextHandle(FName(*textKey, FNAME_Find)) != INDEX_NONE;
 }
 
 void UManagerLocalization::SubscribeToLanguageChanges(UMPHUD* subscriber)
@@ -132,7 +150,14 @@ void UManagerLocalization::SetDataTable(UDataTable* newDataTable)
 
 void UManagerLocalization::LoadTextData()
 {
-	cachedTextData.Empty();
+	// keep textHandles, handles that actors and widgets already resolved must stay valid
+	for (FLocalizedTextTable& table : languageTables)
+	{
+		for (FText& text : table.texts)
+		{
+			text = defaultText;
+		}
+	}
 	
 	if (!textDataTable)
 	{
@@ -148,21 +173,28 @@ void UManagerLocalization::LoadTextData()
 		FLocalizedText* textEntry = textDataTable->FindRow<FLocalizedText>(rowName, TEXT(""));
 		if (textEntry)
 		{
-			FString key = rowName.ToString();
+			int32& textHandle = textHandles.FindOrAdd(rowName, INDEX_NONE);
+			if (textHandle == INDEX_NONE)
+			{
+				textHandle = textHandles.Num() - 1;
+			}
 			
-			// Cache text for all languages
-			for (int32 langIndex = 0; langIndex < static_cast<int32>(ELanguage::Max); ++langIndex)
+			// Fill the slot in every language table
+			for (int32 langIndex = 0; langIndex < languageTables.Num(); ++langIndex)
 			{
-				ELanguage language = static_cast<ELanguage>(langIndex);
-				FString cacheKey = FString::Printf(TEXT("%s_%d"), *key, langIndex);
-				FText localizedText = textEntry->GetLocalizedText(language);
-				
-				cachedTextData.Add(cacheKey, localizedText);
+				TArray<FText>& texts = languageTables[langIndex].texts;
+				if (texts.Num() <= textHandle)
+				{
+					texts.SetNum(textHandle + 1);
+				}
+				texts[textHandle] = textEntry->GetLocalizedText(static_cast<ELanguage>(langIndex));
 			}
 		}
 	}
 	
-	UManagerLog::LogInfo(FString::Printf(TEXT("Loaded %d text entries"), cachedTextData.Num()), TEXT("ManagerLocalization"));
+	currentTable = GetTable(currentLanguage);
+	
+	MP_LOG_INFO(TEXT("ManagerLocalization"), TEXT("Loaded %d text entries"), textHandles.Num());
 }
 
 UManagerLocalization* UManagerLocalization::GetInstance()
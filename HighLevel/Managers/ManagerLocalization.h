@@ -9,6 +9,7 @@
 // How to utilize in Blueprint:
 // 1. Get the singleton instance of this manager using the static `GetInstance()` function.
 // 2. To get a piece of text for a UI element, call `GetLocalizedText` with the appropriate `textKey`. The key corresponds to a row name in your localization DataTable.
+//    Code that asks for the same key repeatedly should call `FindTextHandle` once and then `GetLocalizedTextByHandle`, which is a plain array read.
 // 3. In your game's Option/Settings menu, you would call `SetCurrentLanguage` on this manager when the player chooses a new language. This will trigger all subscribed UI elements to refresh.
 // 4. Any custom HUD class (`UMPHUD`) that needs its text to update automatically when the language changes should call `SubscribeToLanguageChanges` on this manager during its `Initialize` or `Construct` event, passing in a reference to itself.
 //
@@ -23,6 +24,7 @@
 // - UMPHUD: HUD widgets can subscribe to this manager's `OnLanguageChanged` delegate to know when they need to refresh their text fields.
 // - CommonStruct.h (FLocalizedString): It likely uses structs defined here to structure the data within the DataTable.
 // - FText: The manager's core output is Unreal's `FText` type, which is designed for localization.
+// - Storage: every row name is interned once into an integer handle. Each language owns a flat `FText` array indexed by that handle, and switching language only swaps which array is current. Handles stay valid for the whole session, even if the DataTable is reloaded.
 
 #include "CoreMinimal.h"
 #include "../../CommonStruct.h"
@@ -33,6 +35,16 @@
 class UDataTable;
 class UMPHUD;
 
+// all texts of one language, indexed by text handle
+USTRUCT()
+struct FLocalizedTextTable
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FText> texts;
+};
+
 UCLASS(BlueprintType, Blueprintable)
 class UManagerLocalization : public UManagerMP
 {
@@ -52,6 +64,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Localization")
     FText GetLocalizedTextForLanguage(const FString& textKey, ELanguage language) const;
 
+    // Resolve a key once, INDEX_NONE if the DataTable has no such row
+    UFUNCTION(BlueprintCallable, Category = "Localization")
+    int32 FindTextHandle(FName textKey) const;
+
+    // O(1) lookup of a handle returned by FindTextHandle
+    UFUNCTION(BlueprintCallable, Category = "Localization")
+    FText GetLocalizedTextByHandle(int32 textHandle) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Localization")
+    FText GetLocalizedTextByHandleForLanguage(int32 textHandle, ELanguage language) const;
+
+    // Handle lookup, or the old key lookup (and its warning) when the key never resolved
+    FText GetLocalizedTextByHandleOrKey(int32 textHandle, const FString& textKey) const;
+
     // Set current language (called by Game Instance only)
     UFUNCTION(BlueprintCallable, Category = "Localization")
     void SetCurrentLanguage(ELanguage newLanguage);
@@ -91,9 +117,17 @@ protected:
     UPROPERTY()
     ELanguage currentLanguage;
 
-    // Cached text for quick lookup: key_language -> localized FText
-    UPROPERTY()
-    TMap<FString, FText> cachedTextData;
+    // Row name -> text handle, handles are never reused
+    TMap<FName, int32> textHandles;
+
+    // One table per ELanguage value
+    UPROPERTY(Transient)
+    TArray<FLocalizedTextTable> languageTables;
+
+    // Points into languageTables, swapped by SetCurrentLanguage
+    const FLocalizedTextTable* currentTable = nullptr;
+
+    const FLocalizedTextTable* GetTable(ELanguage language) const;
 
     // Load text data from data table
     UFUNCTION(BlueprintCallable, Category = "Localization")
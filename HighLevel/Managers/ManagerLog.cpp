@@ -2,13 +2,51 @@
 #include "ManagerLog.h"
 
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 #include "Misc/DateTime.h"
 #include "../../CommonStruct.h"
 #include "../../CommonEnum.h"
 
+#include "MPLogFileSink.h"
+
 
 // Initialize static member
 FLogConfig UManagerLog::LogConfig;
+TMap<FName, ELogLevel> UManagerLog::ContextLogLevels;
+FName UManagerLog::LogMatchId;
+
+// owned here rather than in the header, nothing outside this file touches the sink
+static TUniquePtr<FMPLogFileSink> GMPLogFileSink;
+
+// only these need the writer thread restarted, level and screen settings apply on the next line
+static bool HasSameFileSettings(const FLogConfig& a, const FLogConfig& b)
+{
+	return a.enableFileLogging == b.enableFileLogging
+		&& a.fileLogFormat == b.fileLogFormat
+		&& a.fileLogBufferLines == b.fileLogBufferLines
+		&& a.fileLogMaxSizeKB == b.fileLogMaxSizeKB
+		&& a.fileLogMaxRotatedFiles == b.fileLogMaxRotatedFiles;
+}
+
+// mp.Log.Context <Context> [Level 0-5]
+static FAutoConsoleCommand GMPLogContextCommand(
+	TEXT("mp.Log.Context"),
+	TEXT("Override the log level of one UManagerLog context. Usage: mp.Log.Context <Context> [0=None..5=Verbose], no level clears the override."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& args)
+	{
+		if (args.Num() < 1) return;
+
+		if (args.Num() < 2)
+		{
+			UManagerLog::ClearContextLogLevel(FName(*args[0]));
+			return;
+		}
+
+		const int32 level = FMath::Clamp(FCString::Atoi(*args[1]), 0, static_cast<int32>(ELogLevel::Verbose));
+		UManagerLog::SetContextLogLevel(FName(*args[0]), static_cast<ELogLevel>(level));
+	}));
 
 UManagerLog::UManagerLog()
 {
@@ -22,9 +60,61 @@ void UManagerLog::InitializeLogging()
 	LogConfig.enableFileLogging = false;
 	LogConfig.screenLogDuration = 5.0f;
 
+	// dedicated hosts keep their match logs on disk
+	LogConfig.enableFileLogging = IsRunningDedicatedServer() || FParse::Param(FCommandLine::Get(), TEXT("MPFileLog"));
+	ApplyFileLogging();
+
 	LogInfo(TEXT("Logging system initialized"), TEXT("ManagerLog"));
 }
 
+void UManagerLog::ShutdownLogging()
+{
+	LogConfig.enableFileLogging = false;
+	ApplyFileLogging();
+}
+
+void UManagerLog::SetLogMatchId(const FString& matchId)
+{
+	LogMatchId = matchId.IsEmpty() ? NAME_None : FName(*matchId);
+}
+
+void UManagerLog::GetFileLogCounters(int64& writtenLines, int64& droppedLines)
+{
+	writtenLines = GMPLogFileSink ? static_cast<int64>(GMPLogFileSink->GetWrittenLines()) : 0;
+	droppedLines = GMPLogFileSink ? static_cast<int64>(GMPLogFileSink->GetDroppedLines()) : 0;
+}
+
+void UManagerLog::ApplyFileLogging()
+{
+	if (!LogConfig.enableFileLogging)
+	{
+		if (GMPLogFileSink)
+		{
+			// detach first so nothing enqueues while the writer drains
+			TUniquePtr<FMPLogFileSink> oldSink = MoveTemp(GMPLogFileSink);
+			UE_LOG(LogTemp, Log, TEXT("[INFO] File logging stopped, %llu lines written, %llu dropped [ManagerLog]"),
+				oldSink->GetWrittenLines(), oldSink->GetDroppedLines());
+			oldSink->StopWriter();
+		}
+		return;
+	}
+
+	// a new config may change format or limits, restart the writer with it
+	if (GMPLogFileSink)
+	{
+		TUniquePtr<FMPLogFileSink> oldSink = MoveTemp(GMPLogFileSink);
+		oldSink->StopWriter();
+	}
+
+	GMPLogFileSink = MakeUnique<FMPLogFileSink>(LogConfig);
+	if (!GMPLogFileSink->StartWriter())
+	{
+		GMPLogFileSink.Reset();
+		LogConfig.enableFileLogging = false;
+		UE_LOG(LogTemp, Warning, TEXT("[WARN] Could not open the match log file, file logging disabled [ManagerLog]"));
+	}
+}
+
 void UManagerLog::LogError(const FString& message, const FString& context)
 {
 	InternalLog(ELogLevel::Error, message, context);
@@ -52,7 +142,12 @@ void UManagerLog::LogVerbose(const FString& message, const FString& context)
 
 void UManagerLog::SetLogConfig(const FLogConfig& newConfig)
 {
+	const bool fileSettingsChanged = !HasSameFileSettings(LogConfig, newConfig);
 	LogConfig = newConfig;
+	if (fileSettingsChanged)
+	{
+		ApplyFileLogging();
+	}
 	LogInfo(TEXT("Logging configuration updated"), TEXT("ManagerLog"));
 }
 
@@ -61,6 +156,33 @@ bool UManagerLog::ShouldLog(ELogLevel level)
 	return static_cast<uint8>(level) <= static_cast<uint8>(LogConfig.logLevel);
 }
 
+bool UManagerLog::ShouldLogContext(ELogLevel level, FName context)
+{
+	if (ContextLogLevels.Num() > 0)
+	{
+		if (const ELogLevel* contextLevel = ContextLogLevels.Find(context))
+		{
+			return static_cast<uint8>(level) <= static_cast<uint8>(*contextLevel);
+		}
+	}
+	return ShouldLog(level);
+}
+
+void UManagerLog::SetContextLogLevel(FName context, ELogLevel level)
+{
+	ContextLogLevels.Add(context, level);
+}
+
+void UManagerLog::ClearContextLogLevel(FName context)
+{
+	ContextLogLevels.Remove(context);
+}
+
+void UManagerLog::LogFormatted(ELogLevel level, FString&& message, FName context)
+{
+	WriteLog(level, MoveTemp(message), context);
+}
+
 FString UManagerLog::FormatLogMessage(ELogLevel level, const FString& message, const FString& context)
 {
 	FString formattedMessage = FString::Printf(TEXT("[%s] %s"), *GetLogLevelString(level), *message);
@@ -75,12 +197,21 @@ FString UManagerLog::FormatLogMessage(ELogLevel level, const FString& message, c
 
 void UManagerLog::InternalLog(ELogLevel level, const FString& message, const FString& context)
 {
-	if (!ShouldLog(level))
+	const bool shouldLog = ContextLogLevels.Num() > 0
+		? ShouldLogContext(level, FName(*context, FNAME_Find))
+		: ShouldLog(level);
+	if (!shouldLog)
 	{
 		return;
 	}
 
-	FString formattedMessage = FormatLogMessage(level, message, context);
+	// Blueprint callers pass a const string, this is the one copy their line costs
+	WriteLog(level, CopyTemp(message), FName(*context));
+}
+
+void UManagerLog::WriteLog(ELogLevel level, FString&& message, FName context)
+{
+	FString formattedMessage = FormatLogMessage(level, message, context.IsNone() ? FString() : context.ToString());
 	FColor logColor = GetLogColor(level);
 
 	// Console logging
@@ -115,6 +246,12 @@ void UManagerLog::InternalLog(ELogLevel level, const FString& message, const FSt
 			formattedMessage
 		);
 	}
+
+	// File logging (if enabled), last so the message can be moved to the writer thread
+	if (GMPLogFileSink)
+	{
+		GMPLogFileSink->Enqueue(level, MoveTemp(message), context, LogMatchId);
+	}
 }
 
 FColor UManagerLog::GetLogColor(ELogLevel level)
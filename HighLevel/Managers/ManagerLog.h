@@ -11,6 +11,10 @@
 // 2. To log an error, call `UManagerLog::LogError`. Pass in the message and an optional context string.
 // 3. Similarly, use `LogWarning`, `LogInfo`, etc., for different levels of logging.
 // 4. In a central place, like the Game Instance on startup, you can call `SetLogConfig` to configure the logging behavior, such as the minimum log level to display or whether to log to the screen.
+// 5. From C++, prefer the `MP_LOG_ERROR` / `MP_LOG_WARNING` / `MP_LOG_INFO` / `MP_LOG_DEBUG` / `MP_LOG_VERBOSE` macros, e.g. `MP_LOG_INFO(TEXT("MPGS"), TEXT("Progression Updated to %f"), value);`.
+//    They check the level before the message is formatted, so a filtered log costs one comparison. Debug and Verbose are compiled out of Shipping and dedicated server builds (see `MP_LOG_COMPILE_LEVEL`).
+// 6. With `enableFileLogging`, every message that passes the filter is also written to `Saved/Logs/MatchLogs/` by `FMPLogFileSink` on a background thread. Dedicated servers turn it on by default. `SetLogMatchId` tags the following lines with the current match.
+// 7. A single context can be made louder or quieter at runtime with `SetContextLogLevel`, or with the console command `mp.Log.Context <Context> <Level>` (no level clears the override).
 //
 // Necessary things to define:
 // - There are no properties to set in the editor. All configuration is done at runtime via the `SetLogConfig` function, which takes an `FLogConfig` struct.
@@ -22,16 +26,55 @@
 // - ELogLevel (Enum): This enum defines the different severity levels for log messages (Error, Warning, Info, etc.).
 // - Any Blueprint/Class: Any part of the game's code or Blueprint graph can call the static Log functions to output messages, making it a globally accessible utility.
 // - UEngine: It uses the global `GEngine` object to print messages to the screen via `AddOnScreenDebugMessage`.
+// - FMPLogFileSink: The optional file output. It is created and destroyed by `SetLogConfig` / `ShutdownLogging`.
+// - UMPGI: Calls `InitializeLogging` on startup and `ShutdownLogging` on shutdown, so buffered file lines are flushed.
+// - UManagerMatch: Sets a fresh match id when a match starts.
 
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
 
 #include "ManagerMP.h"
+#include "../../CommonEnum.h"
 #include "ManagerLog.generated.h"
 
-enum class ELogLevel : uint8;
 struct FLogConfig;
 
+// highest ELogLevel that is compiled in at all, Debug (4) and Verbose (5) are stripped from shipping and server builds
+#ifndef MP_LOG_COMPILE_LEVEL
+	#if UE_BUILD_SHIPPING || UE_SERVER
+		#define MP_LOG_COMPILE_LEVEL 3
+	#else
+		#define MP_LOG_COMPILE_LEVEL 5
+	#endif
+#endif
+
+// the context literal is turned into an FName once per call site
+#define MP_LOG(level, context, format, ...) \
+	do \
+	{ \
+		static const FName mpLogContextName(context); \
+		if (UManagerLog::ShouldLogContext(level, mpLogContextName)) \
+		{ \
+			UManagerLog::LogFormatted(level, FString::Printf(format, ##__VA_ARGS__), mpLogContextName); \
+		} \
+	} while (0)
+
+#define MP_LOG_ERROR(context, format, ...) MP_LOG(ELogLevel::Error, context, format, ##__VA_ARGS__)
+#define MP_LOG_WARNING(context, format, ...) MP_LOG(ELogLevel::Warning, context, format, ##__VA_ARGS__)
+#define MP_LOG_INFO(context, format, ...) MP_LOG(ELogLevel::Info, context, format, ##__VA_ARGS__)
+
+#if MP_LOG_COMPILE_LEVEL >= 4
+	#define MP_LOG_DEBUG(context, format, ...) MP_LOG(ELogLevel::Debug, context, format, ##__VA_ARGS__)
+#else
+	#define MP_LOG_DEBUG(context, format, ...) do {} while (0)
+#endif
+
+#if MP_LOG_COMPILE_LEVEL >= 5
+	#define MP_LOG_VERBOSE(context, format, ...) MP_LOG(ELogLevel::Verbose, context, format, ##__VA_ARGS__)
+#else
+	#define MP_LOG_VERBOSE(context, format, ...) do {} while (0)
+#endif
+
 UCLASS(BlueprintType, Blueprintable)
 class UManagerLog : public UManagerMP
 {
@@ -44,6 +87,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Logging")
 	static void InitializeLogging();
 
+	// Stop the file writer and flush everything it still holds
+	UFUNCTION(BlueprintCallable, Category = "Logging")
+	static void ShutdownLogging();
+
+	// Match id written with every file log line
+	UFUNCTION(BlueprintCallable, Category = "Logging")
+	static void SetLogMatchId(const FString& matchId);
+
+	// Lines written to / dropped before the log file since file logging was turned on
+	UFUNCTION(BlueprintCallable, Category = "Logging")
+	static void GetFileLogCounters(int64& writtenLines, int64& droppedLines);
+
 	// Logging methods with different levels
 	UFUNCTION(BlueprintCallable, Category = "Logging")
 	static void LogError(const FString& message, const FString& context = TEXT(""));
@@ -72,6 +127,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Logging")
 	static bool ShouldLog(ELogLevel level);
 
+	// Same check, honouring a per-context override if one is set
+	static bool ShouldLogContext(ELogLevel level, FName context);
+
+	// Override the log level of one context, it wins over the global level in both directions
+	UFUNCTION(BlueprintCallable, Category = "Logging")
+	static void SetContextLogLevel(FName context, ELogLevel level);
+
+	UFUNCTION(BlueprintCallable, Category = "Logging")
+	static void ClearContextLogLevel(FName context);
+
+	// Output an already filtered and formatted message, used by the MP_LOG macros; the message is moved on to the file writer
+	static void LogFormatted(ELogLevel level, FString&& message, FName context);
+
 	// Format log message
 	UFUNCTION(BlueprintCallable, Category = "Logging")
 	static FString FormatLogMessage(ELogLevel level, const FString& message, const FString& context);
@@ -80,6 +148,18 @@ private:
 	// Current logging configuration
 	static FLogConfig LogConfig;
 
+	// Match id of the running match, None outside of a match; a name so every file line shares it without a copy
+	static FName LogMatchId;
+
+	// Start or stop the file sink to match LogConfig
+	static void ApplyFileLogging();
+
+	// Per-context level overrides, empty in the common case so the check stays a single comparison
+	static TMap<FName, ELogLevel> ContextLogLevels;
+
+	// Output without the level check
+	static void WriteLog(ELogLevel level, FString&& message, FName context);
+
 	// Internal logging method
 	static void InternalLog(ELogLevel level, const FString& message, const FString& context);
 
@@ -6,9 +6,11 @@
 
 #include "../MPGMGameplay.h"
 #include "../MPGS.h"
+#include "../MPWorldRegistry.h"
 
 #include "../Managers/ManagerLog.h"
 #include "../Managers/ManagerAIController.h"
+#include "../Managers/ManagerMatchClock.h"
 
 #include "../Factory/FactoryHuman.h"
 #include "../Factory/FactoryCat.h"
@@ -26,6 +28,7 @@
 #include "../../MPActor/AI/MPAISystemManager.h"
 #include "../../MPActor/Player/Widget/HUDLobbyManager.h"
 #include "../../MPActor/Player/Widget/HUDEnd.h"
+#include "../MPWanderPointCache.h"
 
 // character custom
 void UManagerMatch::StartCustomizeCharacter()
@@ -47,28 +50,17 @@ void UManagerMatch::StartCustomizeCharacter()
         }
     }
 
-    CountdownCustomizeCharacter();
+    if (gameMode->GetManagerMatchClock())
+    {
+        gameMode->GetManagerMatchClock()->StartPhase(EGPStatus::ECustomCharacter, gameMode->GetGameState()->customCharacterTotalTime);
+    }
 }
 
 void UManagerMatch::CountdownCustomizeCharacter()
 {
     if (!gameMode || !gameMode->GetGameState()) return;
 
-    if (gameMode->GetGameState()->curCustomCharacterTime > 0)
-    {
-        UWorld* serverWorld = gameMode->GetWorld();
-        if (serverWorld)
-        {
-            gameMode->GetGameState()->curCustomCharacterTime -= 1;
-            gameMode->ClientUpdateCustomizationCountdown(gameMode->GetGameState()->curCustomCharacterTime);
-
-            serverWorld->GetTimerManager().ClearTimer(customCharacterTimerHandle);
-            FTimerDelegate customCharacterTimerDel;
-            customCharacterTimerDel.BindUFunction(this, FName("CountdownCustomizeCharacter"));
-            serverWorld->GetTimerManager().SetTimer(customCharacterTimerHandle, customCharacterTimerDel, 1, false);
-        }
-    }
-    else
+    if (gameMode->GetGameState()->curCustomCharacterTime <= 0)
     {
         EndCustomizeCharacter();
     }
@@ -92,6 +84,7 @@ void UManagerMatch::EndCustomizeCharacter()
 // start game
 void UManagerMatch::StartGame()
 {
+    UManagerLog::SetLogMatchId(FGuid::NewGuid().ToString(EGuidFormats::Digits));
     UManagerLog::LogInfo(TEXT("Starting Game"), TEXT("ManagerMatch"));
     SetupGame();
     StartPrepareTime();
@@ -108,17 +101,29 @@ void UManagerMatch::SetupMap()
 {
     SetupMapItems();
     SetupMapEnvActors();
+    SetupMapWanderPoints();
+}
+
+void UManagerMatch::SetupMapWanderPoints()
+{
+    if (!gameMode) return;
+    if (UMPWanderPointCache* wanderCache = gameMode->GetWorld()->GetSubsystem<UMPWanderPointCache>())
+    {
+        wanderCache->BuildCache();
+    }
 }
 
 void UManagerMatch::SetupMapItems()
 {
     if (!gameMode) return;
-    TArray<AActor*> allActors;
-    UGameplayStatics::GetAllActorsOfClass(gameMode->GetWorld(), AMPItem::StaticClass(), allActors);
+    UMPWorldRegistry* registry = gameMode->GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry) return;
 
-    for (AActor* eachActor : allActors)
+    // backwards, eliminating an item swaps the last entry into its slot
+    const TArray<AMPItem*>& allItems = registry->GetItems();
+    for (int32 i = allItems.Num() - 1; i >= 0; i--)
     {
-        AMPItem* eachItem = Cast<AMPItem>(eachActor);
+        AMPItem* eachItem = allItems[i];
         if (eachItem)
         {
             int32 randomNumber = FMath::RandRange(1, 100);
@@ -133,13 +138,14 @@ void UManagerMatch::SetupMapItems()
 void UManagerMatch::SetupMapEnvActors()
 {
     if (!gameMode || !gameMode->GetGameState()) return;
+    UMPWorldRegistry* registry = gameMode->GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry) return;
 
-    TArray<AActor*> allActors;
-    UGameplayStatics::GetAllActorsOfClass(gameMode->GetWorld(), AMPEnvActorComp::StaticClass(), allActors);
-
-    for (AActor* eachActor : allActors)
+    // backwards, a randomized actor may leave the registry and swap the last entry into its slot
+    const TArray<AMPEnvActorComp*>& allEnvActors = registry->GetEnvActors();
+    for (int32 i = allEnvActors.Num() - 1; i >= 0; i--)
     {
-        AMPEnvActorComp* eachEnvActor = Cast<AMPEnvActorComp>(eachActor);
+        AMPEnvActorComp* eachEnvActor = allEnvActors[i];
         if (eachEnvActor)
         {
             int32 randomNumber = FMath::RandRange(1, 100);
@@ -151,25 +157,16 @@ void UManagerMatch::SetupMapEnvActors()
     }
 
     float totalProgressionWeight = 0.0f;
-    TArray<AActor*> remainingActors;
-    UGameplayStatics::GetAllActorsOfClass(gameMode->GetWorld(), AMPEnvActorComp::StaticClass(), remainingActors);
-
-    for (AActor* eachActor : remainingActors)
+    for (AMPEnvActorComp* eachEnvActor : registry->GetEnvActors())
     {
-        AMPEnvActorComp* eachEnvActor = Cast<AMPEnvActorComp>(eachActor);
-        if (eachEnvActor)
+        AMPEnvActorCompPushable* pushableActor = Cast<AMPEnvActorCompPushable>(eachEnvActor);
+        if (pushableActor)
         {
-            AMPEnvActorCompPushable* pushableActor = Cast<AMPEnvActorCompPushable>(eachEnvActor);
-            if (pushableActor)
-            {
-                totalProgressionWeight += pushableActor->GetProgressionWeight();
-            }
+            totalProgressionWeight += pushableActor->GetProgressionWeight();
         }
     }
 
-    gameMode->GetGameState()->totalMPProgression = totalProgressionWeight;
-    gameMode->GetGameState()->curMPProgression = 0.0f;
-    gameMode->GetGameState()->curMPProgressionPercentage = 0.0f;
+    gameMode->GetGameState()->ResetMPProgression(totalProgressionWeight);
 
     if (totalProgressionWeight <= 0.0f)
     {
@@ -178,8 +175,8 @@ void UManagerMatch::SetupMapEnvActors()
     else
     {
         float requiredProgression = totalProgressionWeight * gameMode->GetGameState()->catWinProgressionPercentage;
-        UManagerLog::LogInfo(FString::Printf(TEXT("Cat Team Objective Set: Total Weight = %f, Required = %f (%.1f%%)"),
-        totalProgressionWeight, requiredProgression, gameMode->GetGameState()->catWinProgressionPercentage * 100.0f), TEXT("ManagerMatch"));
+        MP_LOG_INFO(TEXT("ManagerMatch"), TEXT("Cat Team Objective Set: Total Weight = %f, Required = %f (%.1f%%)"),
+        totalProgressionWeight, requiredProgression, gameMode->GetGameState()->catWinProgressionPercentage * 100.0f);
     }
 }
 
@@ -242,9 +239,12 @@ void UManagerMatch::SetupPlayers()
         }
     }
 
-    gameMode->GetGameState()->totalCatPlayers = catPlayerCount;
-    gameMode->GetGameState()->caughtCats = 0;
-    gameMode->GetGameState()->caughtCatsPercentage = 0.0f;
+    // a new match, the previous one left isMatchEnded set and RegisterHumanDeath would drop every event until gameplay
+    isMatchEnded = false;
+    totalHumanPlayers = humanIndex;
+    aliveHumanPlayers = humanIndex;
+
+    gameMode->GetGameState()->ResetHumanProgression(catPlayerCount);
 
     if (catPlayerCount <= 0)
     {
@@ -252,7 +252,7 @@ void UManagerMatch::SetupPlayers()
     }
     else
     {
-        UManagerLog::LogInfo(FString::Printf(TEXT("Human Team Objective Set: Catch %d Cat Players"), catPlayerCount), TEXT("ManagerMatch"));
+        MP_LOG_INFO(TEXT("ManagerMatch"), TEXT("Human Team Objective Set: Catch %d Cat Players"), catPlayerCount);
     }
 }
 
@@ -272,7 +272,10 @@ void UManagerMatch::StartPrepareTime()
 
     gameMode->GetGameState()->curGameplayStatus = EGPStatus::EPrepare;
     gameMode->GetGameState()->curPrepareTime = gameMode->GetGameState()->prepareTotalTime;
-    CountdownPrepareGame();
+    if (gameMode->GetManagerMatchClock())
+    {
+        gameMode->GetManagerMatchClock()->StartPhase(EGPStatus::EPrepare, gameMode->GetGameState()->prepareTotalTime);
+    }
 
     for (AMPControllerPlayer* eachPlayer : gameMode->GetAllPlayerControllers())
     {
@@ -284,20 +287,7 @@ void UManagerMatch::CountdownPrepareGame()
 {
     if (!gameMode || !gameMode->GetGameState()) return;
 
-    if (gameMode->GetGameState()->curPrepareTime > 0)
-    {
-        UWorld* serverWorld = gameMode->GetWorld();
-        if (serverWorld)
-        {
-            gameMode->GetGameState()->curPrepareTime -= 1;
-
-            serverWorld->GetTimerManager().ClearTimer(prepareTimerHandle);
-            FTimerDelegate prepareTimerDel;
-            prepareTimerDel.BindUFunction(this, FName("CountdownPrepareGame"));
-            serverWorld->GetTimerManager().SetTimer(prepareTimerHandle, prepareTimerDel, 1, false);
-        }
-    }
-    else
+    if (gameMode->GetGameState()->curPrepareTime <= 0)
     {
         EndPrepareTime();
     }
@@ -314,6 +304,8 @@ void UManagerMatch::StartGameplayTime()
 
     gameMode->GetGameState()->curGameplayStatus = EGPStatus::EGameplay;
     gameMode->GetGameState()->curGameplayTime = gameMode->GetGameState()->gameplayTotalTime;
+    isMatchEnded = false;
+    ResetNetDormancyStats();
 
     bool catObjectiveImpossible = (gameMode->GetGameState()->totalMPProgression <= 0.0f);
     bool humanObjectiveImpossible = (gameMode->GetGameState()->totalCatPlayers <= 0);
@@ -331,36 +323,28 @@ void UManagerMatch::StartGameplayTime()
         UManagerLog::LogWarning(TEXT("Human team has impossible objective - no cat players to catch"), TEXT("ManagerMatch"));
     }
 
-    CountdownGameplayGame();
+    if (gameMode->GetManagerMatchClock())
+    {
+        gameMode->GetManagerMatchClock()->StartPhase(EGPStatus::EGameplay, gameMode->GetGameState()->gameplayTotalTime);
+    }
 
     for (AMPControllerPlayer* eachPlayer : gameMode->GetAllPlayerControllers())
     {
         eachPlayer->GameplayStartUpdate();
     }
+
+    // end conditions are event-driven, and deaths or disconnects during EPrepare fired before this phase could end the match
+    CheckIfGameEnd();
 }
 
 void UManagerMatch::CountdownGameplayGame()
 {
     if (!gameMode || !gameMode->GetGameState()) return;
 
-    if (gameMode->GetGameState()->curGameplayTime > 0)
-    {
-        UWorld* serverWorld = gameMode->GetWorld();
-        if (serverWorld)
-        {
-            gameMode->GetGameState()->curGameplayTime -= 1;
-            CheckIfGameEnd();
+    SampleNetDormancy();
 
-            if (gameMode->GetGameState()->curGameplayTime > 0)
-            {
-                serverWorld->GetTimerManager().ClearTimer(gameplayTimerHandle);
-                FTimerDelegate gameplayTimerDel;
-                gameplayTimerDel.BindUFunction(this, FName("CountdownGameplayGame"));
-                serverWorld->GetTimerManager().SetTimer(gameplayTimerHandle, gameplayTimerDel, 1, false);
-            }
-        }
-    }
-    else
+    // every other end condition is checked by the event that changes it
+    if (gameMode->GetGameState()->curGameplayTime <= 0)
     {
         CheckIfGameEnd();
     }
@@ -369,76 +353,51 @@ void UManagerMatch::CountdownGameplayGame()
 bool UManagerMatch::CheckIfGameEnd()
 {
     if (!gameMode || !gameMode->GetGameState()) return false;
+    if (isMatchEnded) return true;
+
+    AMPGS* theGameState = gameMode->GetGameState();
+    if (theGameState->curGameplayStatus != EGPStatus::EGameplay) return false;
 
     bool isGameEnd = false;
     FString winningTeam = TEXT("");
 
-    if (gameMode->GetGameState()->totalMPProgression > 0.0f && gameMode->GetGameState()->curMPProgression >= 0.0f)
+    if (theGameState->totalMPProgression > 0.0f &&
+        theGameState->curMPProgressionPercentage >= theGameState->catWinProgressionPercentage)
     {
-        bool hasReachedTarget = (gameMode->GetGameState()->curMPProgressionPercentage >= gameMode->GetGameState()->catWinProgressionPercentage);
-        if (hasReachedTarget)
-        {
-            isGameEnd = true;
-            winningTeam = TEXT("Cat");
-        }
+        isGameEnd = true;
+        winningTeam = TEXT("Cat");
     }
-
-    if (!isGameEnd && gameMode->GetGameState()->totalCatPlayers > 0)
+    else if (theGameState->totalCatPlayers > 0 &&
+        (theGameState->caughtCats >= theGameState->totalCatPlayers || theGameState->caughtCatsPercentage >= 0.999f))
     {
-        bool hasCaughtAllCats = (gameMode->GetGameState()->caughtCats >= gameMode->GetGameState()->totalCatPlayers) ||
-                                (gameMode->GetGameState()->caughtCatsPercentage >= 0.999f);
-        if (hasCaughtAllCats)
-        {
-            isGameEnd = true;
-            winningTeam = TEXT("Human");
-        }
+        isGameEnd = true;
+        winningTeam = TEXT("Human");
     }
-
-    if (!isGameEnd)
+    else if (totalHumanPlayers > 0 && aliveHumanPlayers <= 0)
     {
-        bool allHumansDead = true;
-        for (AMPControllerPlayer* eachPlayer : gameMode->GetAllPlayerControllers())
-        {
-            AMPPlayerState* eachState = Cast<AMPPlayerState>(eachPlayer->PlayerState);
-            if (eachState && eachState->playerTeam == ETeam::EHuman)
-            {
-                AMPCharacterHuman* humanChar = Cast<AMPCharacterHuman>(eachPlayer->GetPawn());
-                if (humanChar && !humanChar->IsDead())
-                {
-                    allHumansDead = false;
-                    break;
-                }
-            }
-        }
-        if (allHumansDead)
-        {
-            isGameEnd = true;
-            winningTeam = TEXT("Cat (All Humans Dead)");
-        }
+        isGameEnd = true;
+        winningTeam = TEXT("Cat (All Humans Dead)");
     }
-
-    if (!isGameEnd && gameMode->GetGameState()->curGameplayTime == 0)
+    else if (theGameState->curGameplayTime <= 0)
     {
-        if (gameMode->GetGameState()->curMPProgressionPercentage > gameMode->GetGameState()->caughtCatsPercentage)
+        isGameEnd = true;
+        if (theGameState->curMPProgressionPercentage > theGameState->caughtCatsPercentage)
         {
-            isGameEnd = true;
             winningTeam = TEXT("Cat (Time Out)");
         }
-        else if (gameMode->GetGameState()->caughtCatsPercentage > gameMode->GetGameState()->curMPProgressionPercentage)
+        else if (theGameState->caughtCatsPercentage > theGameState->curMPProgressionPercentage)
         {
-            isGameEnd = true;
             winningTeam = TEXT("Human (Time Out)");
         }
         else
         {
-            isGameEnd = true;
             winningTeam = TEXT("Cat (Time Out Tie)");
         }
     }
 
     if (isGameEnd)
     {
-        UManagerLog::LogInfo(FString::Printf(TEXT("=== GAME END: %s Team Wins! ==="), *winningTeam), TEXT("ManagerMatch"));
+        MP_LOG_INFO(TEXT("ManagerMatch"), TEXT("=== GAME END: %s Team Wins! ==="), *winningTeam);
         EndGameplayTime();
         return true;
     }
@@ -446,10 +405,27 @@ bool UManagerMatch::CheckIfGameEnd()
     return false;
 }
 
+void UManagerMatch::RegisterHumanDeath()
+{
+    if (isMatchEnded || aliveHumanPlayers <= 0) return;
+
+    aliveHumanPlayers--;
+    MP_LOG_INFO(TEXT("ManagerMatch"), TEXT("Human player out: %d/%d still alive"), aliveHumanPlayers, totalHumanPlayers);
+
+    CheckIfGameEnd();
+}
+
 void UManagerMatch::EndGameplayTime()
 {
     if (!gameMode || !gameMode->GetGameState()) return;
 
+    isMatchEnded = true;
+
+    if (gameMode->GetManagerMatchClock())
+    {
+        gameMode->GetManagerMatchClock()->StopPhase();
+    }
+
     RemoveGameplayHUD();
 
     FString resultKey;
@@ -498,6 +474,8 @@ void UManagerMatch::EndGameplayTime()
     }
 
     UManagerLog::LogInfo(TEXT("Game ended. Players can manually restart or wait for auto-restart."), TEXT("ManagerMatch"));
+    gameMode->DisplayPoolStatus();
+    DisplayNetDormancySummary();
 }
 
 void UManagerMatch::RemoveGameplayHUD()
@@ -568,13 +546,64 @@ void UManagerMatch::DisplayProgressionStatus()
     if (!gameMode || !gameMode->GetGameState()) return;
 
     UManagerLog::LogInfo(TEXT("=== Game Progression Status ==="), TEXT("ManagerMatch"));
-    UManagerLog::LogInfo(FString::Printf(TEXT("Cat Team: %f/%f (%.1f%%) - Required: %.1f%%"),
+    MP_LOG_INFO(TEXT("ManagerMatch"), TEXT("Cat Team: %f/%f (%.1f%%) - Required: %.1f%%"),
         gameMode->GetGameState()->curMPProgression, gameMode->GetGameState()->totalMPProgression,
         gameMode->GetGameState()->curMPProgressionPercentage * 100.0f,
-        gameMode->GetGameState()->catWinProgressionPercentage * 100.0f), TEXT("ManagerMatch"));
-    UManagerLog::LogInfo(FString::Printf(TEXT("Human Team: %d/%d (%.1f%%)"),
+        gameMode->GetGameState()->catWinProgressionPercentage * 100.0f);
+    MP_LOG_INFO(TEXT("ManagerMatch"), TEXT("Human Team: %d/%d (%.1f%%)"),
         gameMode->GetGameState()->caughtCats, gameMode->GetGameState()->totalCatPlayers,
-        gameMode->GetGameState()->caughtCatsPercentage * 100.0f), TEXT("ManagerMatch"));
-    UManagerLog::LogInfo(FString::Printf(TEXT("Time Remaining: %d seconds"), gameMode->GetGameState()->curGameplayTime), TEXT("ManagerMatch"));
+        gameMode->GetGameState()->caughtCatsPercentage * 100.0f);
+    MP_LOG_INFO(TEXT("ManagerMatch"), TEXT("Time Remaining: %d seconds"), gameMode->GetGameState()->curGameplayTime);
     UManagerLog::LogInfo(TEXT("================================"), TEXT("ManagerMatch"));
-} 
\ No newline at end of file
+} 
+
+// net dormancy summary
+void UManagerMatch::ResetNetDormancyStats()
+{
+    dormancySamples = 0;
+    sampledDormantActors = 0;
+    sampledTrackedActors = 0;
+    peakAwakeActors = 0;
+}
+
+void UManagerMatch::SampleNetDormancy()
+{
+    if (!gameMode) return;
+    UMPWorldRegistry* registry = gameMode->GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry) return;
+
+    int32 dormantActors = 0;
+    int32 trackedActors = 0;
+    for (AMPItem* eachItem : registry->GetItems())
+    {
+        if (!eachItem) continue;
+        trackedActors++;
+        if (eachItem->IsNetDormant()) dormantActors++;
+    }
+    for (AMPEnvActorComp* eachEnvActor : registry->GetEnvActors())
+    {
+        if (!eachEnvActor) continue;
+        trackedActors++;
+        if (eachEnvActor->IsNetDormant()) dormantActors++;
+    }
+
+    dormancySamples++;
+    sampledDormantActors += dormantActors;
+    sampledTrackedActors += trackedActors;
+    peakAwakeActors = FMath::Max(peakAwakeActors, trackedActors - dormantActors);
+}
+
+void UManagerMatch::DisplayNetDormancySummary()
+{
+    if (dormancySamples <= 0 || sampledTrackedActors <= 0)
+    {
+        UManagerLog::LogInfo(TEXT("Net dormancy: no samples this match"), TEXT("ManagerMatch"));
+        return;
+    }
+
+    const float averageTracked = (float)sampledTrackedActors / dormancySamples;
+    const float averageDormant = (float)sampledDormantActors / dormancySamples;
+    MP_LOG_INFO(TEXT("ManagerMatch"), TEXT("Net dormancy over %d s: %.1f of %.1f items/env actors dormant on average (%.1f%%), peak awake %d"),
+        dormancySamples, averageDormant, averageTracked,
+        100.0f * sampledDormantActors / sampledTrackedActors, peakAwakeActors);
+}
@@ -20,7 +20,11 @@
 // - AMPGMGameplay: The Game Mode owns this manager and initiates the match sequence by calling its `Start...` functions. It is the sole driver of this manager.
 // - Setup Functions (`SetupMap`, `SetupPlayers`, etc.): These internal functions are responsible for coordinating with various Factory and other Manager classes to populate the world with items, environments, and player pawns at the correct time.
 // - AMPControllerPlayer: It receives notifications about player deaths via `RegisterPlayerDeath`.
-// - TimerManager (`FTimerHandle`): It relies heavily on timers to manage the duration of each phase of the game (customization, preparation, gameplay).
+// - UMPWorldRegistry: `SetupMapItems` and `SetupMapEnvActors` iterate the registered items and env actors instead of scanning the level.
+// - UMPWanderPointCache: `SetupMapWanderPoints` builds the bots' wander points once per match, before the AIs are spawned.
+// - Win condition: `CheckIfGameEnd` is event-driven and O(1). It only compares counters (alive human players here; caught cats and progression in `AMPGS`) that are updated on death, catch, push and disconnect events, and the match end fires once.
+// - UManagerMatchClock: Each phase (customization, preparation, gameplay) is started on the shared match clock. The clock calls the matching `Countdown...` function once per second, and that function ends the phase when its time runs out.
+// - Net dormancy: While gameplay runs it counts, once per second, how many registered items and env actors are dormant, and `EndGameplayTime` logs the match summary (`DisplayNetDormancySummary`).
 // - HUDs: It is responsible for telling the HUDs when to appear and disappear, for example, calling `RemoveGameplayHUD` at the end of a match.
 
 #include "CoreMinimal.h"
@@ -36,21 +40,32 @@ class UManagerMatch : public UManagerMP
     GENERATED_BODY()
 
 protected:
-    FTimerHandle customCharacterTimerHandle;
-    FTimerHandle prepareTimerHandle;
-    FTimerHandle gameplayTimerHandle;
-
     void SetupMap();
     void SetupMapItems();
     void SetupMapEnvActors();
+    void SetupMapWanderPoints();
     void SetupPlayers();
     void SetupAIs();
 
     void RemoveGameplayHUD();
 
+    // win condition counters
+    int32 totalHumanPlayers = 0;
+    int32 aliveHumanPlayers = 0;
+    bool isMatchEnded = false;
+
+    // net dormancy summary, sampled once per gameplay second
+    int32 dormancySamples = 0;
+    int64 sampledDormantActors = 0;
+    int64 sampledTrackedActors = 0;
+    int32 peakAwakeActors = 0;
+    void ResetNetDormancyStats();
+    void SampleNetDormancy();
+
 public:
     // Character Customization
     void StartCustomizeCharacter();
+    // per-second tick from UManagerMatchClock
     void CountdownCustomizeCharacter();
     void EndCustomizeCharacter();
 
@@ -66,5 +81,8 @@ public:
     void EndGameplayTime();
 
     void RegisterPlayerDeath(AMPControllerPlayer* diedPlayer, FVector diedPlayerLocation, FRotator diedPlayerRotation);
+    // a human player died or left the match while alive
+    void RegisterHumanDeath();
     void DisplayProgressionStatus();
+    void DisplayNetDormancySummary();
 }; 
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "ManagerMatchClock.h"
+
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+#include "../MPGMGameplay.h"
+#include "../MPGS.h"
+
+#include "../Managers/ManagerLog.h"
+#include "../Managers/ManagerLobby.h"
+#include "../Managers/ManagerMatch.h"
+
+void UManagerMatchClock::StartPhase(EGPStatus phase, int32 durationSeconds)
+{
+    if (!gameMode || !gameMode->GetGameState() || !gameMode->GetWorld()) return;
+
+    curPhase = phase;
+    isPhaseRunning = true;
+
+    gameMode->GetGameState()->SetPhaseClock(phase, FMath::Max(durationSeconds, 0));
+    MirrorRemainingTime(FMath::Max(durationSeconds, 0));
+
+    // phases hand over to each other from inside TickPhase, so the timer only gets armed once
+    FTimerManager& timerManager = gameMode->GetWorld()->GetTimerManager();
+    if (!timerManager.IsTimerActive(phaseTickTimerHandle))
+    {
+        timerManager.SetTimer(phaseTickTimerHandle, this, &UManagerMatchClock::TickPhase, 1.0f, true);
+    }
+}
+
+void UManagerMatchClock::StopPhase()
+{
+    isPhaseRunning = false;
+
+    if (!gameMode) return;
+
+    if (gameMode->GetWorld())
+    {
+        gameMode->GetWorld()->GetTimerManager().ClearTimer(phaseTickTimerHandle);
+    }
+    if (gameMode->GetGameState())
+    {
+        gameMode->GetGameState()->StopPhaseClock();
+    }
+}
+
+bool UManagerMatchClock::IsPhaseRunning(EGPStatus phase) const
+{
+    return isPhaseRunning && curPhase == phase;
+}
+
+int32 UManagerMatchClock::GetRemainingSeconds() const
+{
+    if (!isPhaseRunning || !gameMode || !gameMode->GetGameState()) return 0;
+
+    // round rather than ceil, the looping timer may fire a frame early or late
+    return FMath::Max(FMath::RoundToInt(gameMode->GetGameState()->GetPhaseRemainingTime()), 0);
+}
+
+void UManagerMatchClock::TickPhase()
+{
+    if (!isPhaseRunning || !gameMode)
+    {
+        StopPhase();
+        return;
+    }
+
+    MirrorRemainingTime(GetRemainingSeconds());
+
+    switch (curPhase)
+    {
+    case EGPStatus::ELobby:
+        if (gameMode->GetManagerLobby()) gameMode->GetManagerLobby()->CountdownReadyGame();
+        break;
+    case EGPStatus::ECustomCharacter:
+        if (gameMode->GetManagerMatch()) gameMode->GetManagerMatch()->CountdownCustomizeCharacter();
+        break;
+    case EGPStatus::EPrepare:
+        if (gameMode->GetManagerMatch()) gameMode->GetManagerMatch()->CountdownPrepareGame();
+        break;
+    case EGPStatus::EGameplay:
+        if (gameMode->GetManagerMatch()) gameMode->GetManagerMatch()->CountdownGameplayGame();
+        break;
+    default:
+        break;
+    }
+}
+
+void UManagerMatchClock::MirrorRemainingTime(int32 secondsRemaining)
+{
+    AMPGS* theGameState = gameMode ? gameMode->GetGameState() : nullptr;
+    if (!theGameState) return;
+
+    switch (curPhase)
+    {
+    case EGPStatus::ELobby:
+        theGameState->curReadyTime = secondsRemaining;
+        break;
+    case EGPStatus::ECustomCharacter:
+        theGameState->curCustomCharacterTime = secondsRemaining;
+        break;
+    case EGPStatus::EPrepare:
+        theGameState->curPrepareTime = secondsRemaining;
+        break;
+    case EGPStatus::EGameplay:
+        theGameState->curGameplayTime = secondsRemaining;
+        break;
+    default:
+        break;
+    }
+}
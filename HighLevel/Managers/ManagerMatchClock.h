@@ -0,0 +1,49 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This manager is the single authoritative clock for every timed match phase: the lobby ready
+// countdown, character customization, preparation and gameplay. It runs ONE looping one-second
+// timer on the server for the whole session instead of each phase re-arming its own one-shot timer.
+//
+// How to utilize in Blueprint:
+// 1. This manager is created and owned by the `AMPGMGameplay` Game Mode. It should not be placed in the level manually.
+// 2. Phase owners (`UManagerLobby`, `UManagerMatch`) call `StartPhase` with the phase and its duration when the phase begins, and `StopPhase` when it is cancelled or the match ends.
+// 3. HUDs on any machine should read `AMPGS::GetPhaseRemainingSeconds` instead of waiting for per-second updates.
+//
+// Necessary things to define:
+// - Nothing. The phase durations still come from the `...TotalTime` properties of the Game State.
+//
+// How it interacts with other classes:
+// - UManagerMP: Inherits from the base manager class.
+// - AMPGS: `StartPhase` writes the phase deadline (in server world time) into the replicated `phaseClock` once. Clients interpolate from it locally. On each tick the server mirrors the remaining seconds into the matching `cur...Time` property, which is no longer replicated.
+// - UManagerLobby / UManagerMatch: Every tick is dispatched to the `Countdown...` function of the running phase, which ends the phase once its counter reaches zero.
+
+#include "CoreMinimal.h"
+#include "ManagerMP.h"
+#include "../../CommonEnum.h"
+#include "ManagerMatchClock.generated.h"
+
+class AMPGMGameplay;
+
+UCLASS()
+class UManagerMatchClock : public UManagerMP
+{
+    GENERATED_BODY()
+
+protected:
+    FTimerHandle phaseTickTimerHandle;
+
+    EGPStatus curPhase = EGPStatus::ELobby;
+    bool isPhaseRunning = false;
+
+    void TickPhase();
+    void MirrorRemainingTime(int32 secondsRemaining);
+
+public:
+    void StartPhase(EGPStatus phase, int32 durationSeconds);
+    void StopPhase();
+
+    bool IsPhaseRunning(EGPStatus phase) const;
+    int32 GetRemainingSeconds() const;
+};
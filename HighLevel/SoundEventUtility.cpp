@@ -1,6 +1,7 @@
 #include "SoundEventUtility.h"
 #include "Perception/AISense_Hearing.h"
 #include "Kismet/GameplayStatics.h"
+#include "MPNoiseAggregator.h"
 
 void USoundEventUtility::ReportAIGameplayNoise(UObject* WorldContextObject, FVector Location, float Loudness, AActor* Instigator)
 {
@@ -9,5 +10,10 @@ void USoundEventUtility::ReportAIGameplayNoise(UObject* WorldContextObject, FVec
     {
         Instigator = UGameplayStatics::GetPlayerPawn(World, 0);
     }
+    if (UMPNoiseAggregator* NoiseAggregator = World->GetSubsystem<UMPNoiseAggregator>())
+    {
+        NoiseAggregator->ReportNoise(Location, Loudness, Instigator, TEXT("GameplayNoise"));
+        return;
+    }
     UAISense_Hearing::ReportNoiseEvent(World, Location, Loudness, Instigator, 0.f, TEXT("GameplayNoise"));
 } 
\ No newline at end of file
@@ -15,7 +15,7 @@
 //
 // How it interacts with other classes:
 // - UBlueprintFunctionLibrary: The base class that allows its static functions to be exposed to all Blueprints.
-// - UAISense_Hearing: The `ReportAIGameplayNoise` function's primary purpose is to call `UAISense_Hearing::ReportNoiseEvent`. This makes the sound perceivable by any AI in the world that has a hearing component in its AIPerceptionComponent.
+// - UMPNoiseAggregator: `ReportAIGameplayNoise` hands the noise to the aggregator. The aggregator merges noises that are close in space and time, then calls `UAISense_Hearing::ReportNoiseEvent` once per cluster. That makes the sound perceivable by any AI in the world that has a hearing component in its AIPerceptionComponent.
 // - Any Actor: Any actor in the world can call this function to generate a sound event for the AI system.
 
 #include "CoreMinimal.h"
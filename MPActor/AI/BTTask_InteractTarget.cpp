@@ -1,5 +1,8 @@
 #include "BTTask_InteractTarget.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
 #include "MPAIController.h"
 
 UBTTask_InteractTarget::UBTTask_InteractTarget()
@@ -7,11 +10,19 @@ UBTTask_InteractTarget::UBTTask_InteractTarget()
     NodeName = TEXT("Interact With Target");
 }
 
+void UBTTask_InteractTarget::InitializeFromAsset(UBehaviorTree& Asset)
+{
+    Super::InitializeFromAsset(Asset);
+    TargetKeyId = Asset.BlackboardAsset ? Asset.BlackboardAsset->GetKeyID(BB_TargetKey) : FBlackboard::InvalidKey;
+}
+
 EBTNodeResult::Type UBTTask_InteractTarget::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
     AMPAIController* Ctrl = Cast<AMPAIController>(OwnerComp.GetAIOwner());
     if (!Ctrl) return EBTNodeResult::Failed;
-    UObject* Obj = OwnerComp.GetBlackboardComponent()->GetValueAsObject(BB_TargetKey);
+    UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
+    if (!BB || TargetKeyId == FBlackboard::InvalidKey) return EBTNodeResult::Failed;
+    UObject* Obj = BB->GetValue<UBlackboardKeyType_Object>(TargetKeyId);
     AActor* Target = Cast<AActor>(Obj);
     if (!Target) return EBTNodeResult::Failed;
     Ctrl->StartInteractWithActor(Target);
@@ -16,12 +16,13 @@
 //
 // How it interacts with other classes:
 // - UBTTaskNode: The base class for the task.
-// - UBlackboardComponent: It reads the `BB_TargetKey` from the Blackboard to determine which actor to interact with.
+// - UBlackboardComponent: It reads the `BB_TargetKey` from the Blackboard to determine which actor to interact with. The key name is resolved into a key id once per Behavior Tree asset in `InitializeFromAsset`, so executing the task does no name lookup.
 // - AIController / Pawn: It gets the AI's controlled pawn.
 // - MPInteractable or a similar interface (Inferred): The task's C++ code likely gets the pawn and calls a generic `Interact()` function on it. This function on the pawn would then perform the specific interaction logic, possibly by calling a function on the target actor if it implements an "interactable" interface.
 
 #include "CoreMinimal.h"
 #include "BehaviorTree/BTTaskNode.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
 #include "BTTask_InteractTarget.generated.h"
 
 UCLASS()
@@ -33,5 +34,10 @@ public:
     FName BB_TargetKey = TEXT("TargetActor");
 
     UBTTask_InteractTarget();
+    virtual void InitializeFromAsset(UBehaviorTree& Asset) override;
     virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+protected:
+    // the node is shared by every AI running the tree, the id only depends on the tree's Blackboard asset
+    FBlackboard::FKey TargetKeyId = FBlackboard::InvalidKey;
 }; 
\ No newline at end of file
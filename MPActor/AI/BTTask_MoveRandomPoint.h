@@ -17,7 +17,7 @@
 // How it interacts with other classes:
 // - UBTTaskNode: The base class for the task.
 // - AAIController: The `ExecuteTask` function uses the AI Controller to initiate the move request.
-// - UNavigationSystemV1: It uses the navigation system to find a random reachable point within the specified radius on the NavMesh.
+// - UMPWanderPointCache / UNavigationSystemV1: The point comes from the per-match wander point cache. The task only asks the navigation system for a random reachable point when the cache has nothing in range.
 // - UBlackboardComponent (Potentially): While not directly visible in the header, the C++ implementation might set a "MoveToLocation" vector key on the blackboard and then rely on the engine's built-in "Move To" task to perform the actual movement, or it might call the `MoveToLocation` function on the AI Controller directly.
 
 #include "CoreMinimal.h"
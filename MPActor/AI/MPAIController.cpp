@@ -2,11 +2,19 @@
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
 #include "Perception/AISenseConfig_Hearing.h"
 #include "NavigationSystem.h"
+#include "GameFramework/PawnMovementComponent.h"
 #include "../Character/MPCharacter.h"
+#include "MPAISystemManager.h"
+#include "../../HighLevel/MPWorldRegistry.h"
+#include "../../HighLevel/Managers/ManagerLog.h"
+#include "../../HighLevel/MPWanderPointCache.h"
 
 AMPAIController::AMPAIController()
 {
@@ -20,6 +28,21 @@ void AMPAIController::BeginPlay()
     Super::BeginPlay();
     SetupPerceptionSystem();
     RunBehaviorTreeAsset();
+
+    if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+    {
+        registry->RegisterAIController(this);
+    }
+}
+
+void AMPAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+    {
+        registry->UnregisterAIController(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AMPAIController::Tick(float DeltaSeconds)
@@ -50,7 +73,7 @@ void AMPAIController::SetupPerceptionSystem()
         HearingConfig->DetectionByAffiliation.bDetectNeutrals = true;
         PerceptionComp->ConfigureSense(*HearingConfig);
     }
-    PerceptionComp->OnPerceptionUpdated.AddDynamic(this, &AMPAIController::OnPerceptionUpdated);
+    PerceptionComp->OnPerceptionUpdated.AddDynamic(this, &AMPAIController::HandlePerceptionUpdated);
     // Bind detailed stimulus callback so derived classes can override
     PerceptionComp->OnTargetPerceptionUpdated.AddDynamic(this, &AMPAIController::OnTargetPerceptionUpdated);
     PerceptionComp->SetDominantSense(SightConfig->GetSenseImplementation());
@@ -61,6 +84,49 @@ void AMPAIController::OnPerceptionUpdated(const TArray<AActor*>& UpdatedActors)
     // Base implementation does nothing.
 }
 
+void AMPAIController::HandlePerceptionUpdated(const TArray<AActor*>& UpdatedActors)
+{
+    if (QueueBudgetedPerception()) return;
+    OnPerceptionUpdated(UpdatedActors);
+}
+
+bool AMPAIController::QueueBudgetedPerception()
+{
+    UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    AMPAISystemManager* aiSystem = registry ? registry->GetAISystemManager() : nullptr;
+    if (!aiSystem) return false;
+
+    aiSystem->QueuePerceptionUpdate(this);
+    return true;
+}
+
+void AMPAIController::ProcessQueuedPerception()
+{
+    if (!PerceptionComp) return;
+
+    TArray<AActor*> perceivedActors;
+    PerceptionComp->GetCurrentlyPerceivedActors(nullptr, perceivedActors);
+    OnPerceptionUpdated(perceivedActors);
+}
+
+void AMPAIController::SetBudgetTier(EAIBudgetTier newTier, float tickInterval)
+{
+    budgetTier = newTier;
+    SetActorTickInterval(tickInterval);
+
+    // the controller's own tick is cheap, the cost is in the Behavior Tree, perception and movement ticks;
+    // sight stays on in every tier so bots far from players still spot each other, only slower
+    if (BrainComponent) BrainComponent->SetComponentTickInterval(tickInterval);
+    if (PerceptionComp) PerceptionComp->SetComponentTickInterval(tickInterval);
+    if (APawn* pawn = GetPawn())
+    {
+        if (UPawnMovementComponent* movement = pawn->GetMovementComponent())
+        {
+            movement->SetComponentTickInterval(tickInterval);
+        }
+    }
+}
+
 void AMPAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus)
 {
     // Base implementation does nothing – derived classes can react to specific senses
@@ -78,19 +144,51 @@ void AMPAIController::RunBehaviorTreeAsset()
         if (BehaviorTreeAsset->BlackboardAsset)
         {
             BlackboardComp->InitializeBlackboard(*BehaviorTreeAsset->BlackboardAsset);
+            CacheBlackboardKeys();
         }
         RunBehaviorTree(BehaviorTreeAsset);
     }
 }
 
+void AMPAIController::CacheBlackboardKeys()
+{
+    StateKeyId = ResolveBlackboardKey(BB_StateKey);
+    StunnedKeyId = ResolveBlackboardKey(BB_StunnedKey);
+}
+
+FBlackboard::FKey AMPAIController::ResolveBlackboardKey(FName KeyName) const
+{
+    const UBlackboardData* BlackboardAsset = BlackboardComp ? BlackboardComp->GetBlackboardAsset() : nullptr;
+    if (!BlackboardAsset) return FBlackboard::InvalidKey;
+
+    const FBlackboard::FKey KeyId = BlackboardAsset->GetKeyID(KeyName);
+    if (KeyId == FBlackboard::InvalidKey)
+    {
+        MP_LOG_WARNING(TEXT("AMPAIController"), TEXT("%s: Blackboard %s has no key %s"), *GetName(), *BlackboardAsset->GetName(), *KeyName.ToString());
+    }
+    return KeyId;
+}
+
+void AMPAIController::ClearBBValue(FBlackboard::FKey KeyId)
+{
+    if (BlackboardComp && KeyId != FBlackboard::InvalidKey) BlackboardComp->ClearValue(KeyId);
+}
+
+uint8 AMPAIController::GetBBState() const
+{
+    return GetBBValue<UBlackboardKeyType_Enum>(StateKeyId);
+}
+
+void AMPAIController::SetBBState(uint8 NewState)
+{
+    SetBBValue<UBlackboardKeyType_Enum>(StateKeyId, NewState);
+}
+
 void AMPAIController::ApplyStun(float DurationSeconds)
 {
     if (bStunned) return;
     bStunned = true;
-    if (BlackboardComp)
-    {
-        BlackboardComp->SetValueAsBool(BB_StunnedKey, true);
-    }
+    SetBBValue<UBlackboardKeyType_Bool>(StunnedKeyId, true);
 
     // Notify the possessed pawn so its animation & logic update too
     if (AMPCharacter* Char = Cast<AMPCharacter>(GetPawn()))
@@ -107,10 +205,7 @@ void AMPAIController::ClearStun()
 {
     bStunned = false;
 
-    if (BlackboardComp)
-    {
-        BlackboardComp->SetValueAsBool(BB_StunnedKey, false);
-    }
+    SetBBValue<UBlackboardKeyType_Bool>(StunnedKeyId, false);
 
     if (AMPCharacter* Char = Cast<AMPCharacter>(GetPawn()))
     {
@@ -120,13 +215,33 @@ void AMPAIController::ClearStun()
 
 void AMPAIController::MoveToRandomPoint(float Radius)
 {
-    UNavigationSystemV1* Nav = UNavigationSystemV1::GetCurrent(GetWorld());
     APawn* MyPawn = GetPawn();
-    if (!Nav || !MyPawn) return;
-    FNavLocation OutLoc;
-    if (Nav->GetRandomReachablePointInRadius(MyPawn->GetActorLocation(), Radius, OutLoc))
+    if (!MyPawn) return;
+
+    bool bIsMoving = false;
+
+    // cached points are navigable but may sit on an island, the move request is what tells,
+    // so a partial path must count as a failure or the live query below never runs
+    FVector CachedPoint;
+    UMPWanderPointCache* WanderCache = GetWorld()->GetSubsystem<UMPWanderPointCache>();
+    if (WanderCache && WanderCache->PickPoint(MyPawn->GetActorLocation(), Radius, CachedPoint))
+    {
+        const bool bAllowPartialPath = false;
+        bIsMoving = MoveToLocation(CachedPoint, 5.f, true, true, false, true, nullptr, bAllowPartialPath) != EPathFollowingRequestResult::Failed;
+    }
+
+    if (!bIsMoving)
+    {
+        UNavigationSystemV1* Nav = UNavigationSystemV1::GetCurrent(GetWorld());
+        FNavLocation OutLoc;
+        if (Nav && Nav->GetRandomReachablePointInRadius(MyPawn->GetActorLocation(), Radius, OutLoc))
+        {
+            bIsMoving = MoveToLocation(OutLoc.Location, 5.f) != EPathFollowingRequestResult::Failed;
+        }
+    }
+
+    if (bIsMoving)
     {
-        MoveToLocation(OutLoc.Location, 5.f);
         if (AMPCharacter* Char = Cast<AMPCharacter>(MyPawn))
         {
             Char->AI_Move(FVector2D(1.f,0.f));
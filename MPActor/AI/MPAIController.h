@@ -12,7 +12,7 @@
 // 2. In a child Blueprint, the most important property to set is `Behavior Tree Asset`. Assign the specific Behavior Tree that this AI should run.
 // 3. The perception system (sight and hearing) is set up in C++ but can be configured in the child Blueprint. You can tweak properties like sight radius and hearing range on the `PerceptionComp`.
 // 4. This class exposes helper functions like `ApplyStun` which can be called from other actors (like an ability) to affect the AI.
-// 5. The Blackboard key names (`BB_StateKey`, `BB_StunnedKey`) can be changed in the child Blueprint's defaults if your Blackboard uses different key names.
+// 5. The Blackboard key names (`BB_StateKey`, `BB_StunnedKey`) can be changed in the child Blueprint's defaults if your Blackboard uses different key names. They are resolved into key ids once, when the Blackboard is initialized, and every read and write after that goes through the id.
 //
 // Necessary things to define:
 // - In any child Blueprint, you MUST assign a `UBehaviorTree` asset to the `BehaviorTreeAsset` property. Without it, the AI will do nothing.
@@ -21,13 +21,16 @@
 // - AAIController: The standard Unreal AI Controller it inherits from.
 // - UBehaviorTreeComponent / UBlackboardComponent: It creates and manages these components, which are essential for running the AI logic defined in the Behavior Tree asset.
 // - UAIPerceptionComponent: It sets up and manages the AI's ability to see and hear the world. The `OnPerceptionUpdated` and `OnTargetPerceptionUpdated` functions are the entry points for reacting to perceived stimuli.
+// - AMPAISystemManager: During a match, `OnPerceptionUpdated` no longer runs from the perception callback. The manager queues it, merges repeats, and runs a capped number per frame through `ProcessQueuedPerception`, so the blackboard writes that re-evaluate the Behavior Tree are budgeted too. Children that react in `OnTargetPerceptionUpdated` queue through `QueueBudgetedPerception` and apply the reaction in `ProcessQueuedPerception`. The manager also sets `SetBudgetTier` from the distance to the nearest player: far and dormant bots tick the controller, Behavior Tree, perception and pawn movement less often. Sight stays on in every tier, so bot-vs-bot detection does not depend on where the players are.
 // - Child AI Controllers (e.g., `AMPAIControllerCatBot`): Concrete AI controllers inherit from this class to gain all the base systems and then implement specialized logic.
 // - Behavior Tree Tasks/Services/Decorators: These assets read from and write to the Blackboard owned by this controller to make decisions and control the AI's flow of logic. For example, a task might call `ChooseNextVoluntaryAction`.
+// - Blackboard access from C++: Children resolve their own keys in `CacheBlackboardKeys`, and read and write with `GetBBValue` / `SetBBValue` / `ClearBBValue`. Code outside the controller, like `UManagerAIController`, uses accessors such as `GetBBState`, so no caller looks a key up by name. BT tasks resolve their key names in `InitializeFromAsset` in the same way.
 
 #include "CoreMinimal.h"
 #include "AIController.h"
 #include "../../CommonEnum.h"
 #include "Perception/AIPerceptionTypes.h"
+#include "BehaviorTree/BlackboardComponent.h"
 #include "MPAIController.generated.h"
 
 class UBehaviorTree;
@@ -46,6 +49,7 @@ public:
     AMPAIController();
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaSeconds) override;
 
 protected:
@@ -86,8 +90,26 @@ protected:
     UFUNCTION()
     virtual void OnPerceptionUpdated(const TArray<AActor*>& UpdatedActors);
 
+    // bound to the perception component, hands the update to the AI budget when there is one
+    UFUNCTION()
+    void HandlePerceptionUpdated(const TArray<AActor*>& UpdatedActors);
+
+    // queues this controller on the AI budget, false when there is no AMPAISystemManager and the caller should react now
+    bool QueueBudgetedPerception();
+
     virtual void SetupPerceptionSystem();
 
+    // AI budget, driven by AMPAISystemManager
+public:
+    EAIBudgetTier GetBudgetTier() const { return budgetTier; }
+    void SetBudgetTier(EAIBudgetTier newTier, float tickInterval);
+
+    // runs a deferred perception update with everything perceived right now, so coalesced updates lose nothing
+    virtual void ProcessQueuedPerception();
+
+protected:
+    EAIBudgetTier budgetTier = EAIBudgetTier::Near;
+
     // Behaviour Tree / Blackboard
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="AI")
     UBehaviorTree* BehaviorTreeAsset;
@@ -107,6 +129,35 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Blackboard")
     FName BB_StunnedKey = TEXT("Stunned");
 
+    // Blackboard key ids, resolved from the names above once the Blackboard is initialized
+    FBlackboard::FKey StateKeyId = FBlackboard::InvalidKey;
+    FBlackboard::FKey StunnedKeyId = FBlackboard::InvalidKey;
+
+    // children resolve their own keys here and call Super
+    virtual void CacheBlackboardKeys();
+    FBlackboard::FKey ResolveBlackboardKey(FName KeyName) const;
+
+    // name-free Blackboard access; an unresolved key reads the type's invalid value and ignores writes
+public:
+    template<class TKeyType>
+    typename TKeyType::FDataType GetBBValue(FBlackboard::FKey KeyId) const
+    {
+        if (!BlackboardComp || KeyId == FBlackboard::InvalidKey) return TKeyType::InvalidValue;
+        return BlackboardComp->GetValue<TKeyType>(KeyId);
+    }
+
+    template<class TKeyType>
+    void SetBBValue(FBlackboard::FKey KeyId, typename TKeyType::FDataType Value)
+    {
+        if (BlackboardComp && KeyId != FBlackboard::InvalidKey) BlackboardComp->SetValue<TKeyType>(KeyId, Value);
+    }
+
+    void ClearBBValue(FBlackboard::FKey KeyId);
+
+    // the state key is shared by every AI, its value is an EAICatState or EAIHumanState
+    uint8 GetBBState() const;
+    void SetBBState(uint8 NewState);
+
     // Helper functions
 public:
     UFUNCTION(BlueprintCallable, Category="AI")
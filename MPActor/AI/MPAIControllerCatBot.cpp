@@ -1,6 +1,8 @@
 #include "MPAIControllerCatBot.h"
 #include "../../CommonEnum.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
 #include "../Character/MPCharacterHuman.h"
 #include "../Character/MPCharacterCat.h"
 
@@ -11,10 +13,13 @@ AMPAIControllerCatBot::AMPAIControllerCatBot()
 void AMPAIControllerCatBot::BeginPlay()
 {
     Super::BeginPlay();
-    if (BlackboardComp)
-    {
-        BlackboardComp->SetValueAsEnum(BB_StateKey, static_cast<uint8>(EAICatState::Idle));
-    }
+    SetBBState(static_cast<uint8>(EAICatState::Idle));
+}
+
+void AMPAIControllerCatBot::CacheBlackboardKeys()
+{
+    Super::CacheBlackboardKeys();
+    TargetActorKeyId = ResolveBlackboardKey(BB_TargetActor);
 }
 
 void AMPAIControllerCatBot::Tick(float DeltaSeconds)
@@ -29,17 +34,11 @@ void AMPAIControllerCatBot::OnPerceptionUpdated(const TArray<AActor*>& UpdatedAc
     {
         if (Cast<AMPCharacterHuman>(Actor))
         {
-            if (BlackboardComp)
-            {
-                BlackboardComp->SetValueAsObject(BB_TargetActor, Actor);
-            }
+            SetBBValue<UBlackboardKeyType_Object>(TargetActorKeyId, Actor);
             return;
         }
     }
-    if (BlackboardComp)
-    {
-        BlackboardComp->ClearValue(BB_TargetActor);
-    }
+    ClearBBValue(TargetActorKeyId);
 }
 
 void AMPAIControllerCatBot::ChooseNextVoluntaryAction()
@@ -58,7 +57,7 @@ void AMPAIControllerCatBot::ChooseNextVoluntaryAction()
         Chosen = EAICatState::InteractHuman;
     }
 
-    BlackboardComp->SetValueAsEnum(BB_StateKey, static_cast<uint8>(Chosen));
+    SetBBState(static_cast<uint8>(Chosen));
 
     // Trigger idle pose timer if needed
     if (Chosen == EAICatState::Idle) {
@@ -49,6 +49,9 @@ protected:
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Blackboard")
     FName BB_TargetActor = TEXT("TargetActor");
+    FBlackboard::FKey TargetActorKeyId = FBlackboard::InvalidKey;
+
+    virtual void CacheBlackboardKeys() override;
 
     // Decision making
     virtual void ChooseNextVoluntaryAction() override;
@@ -1,6 +1,9 @@
 #include "MPAIControllerCatPlayer.h"
 #include "../../CommonEnum.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
 #include "../Character/MPCharacterCat.h"
 #include "../Character/MPCharacterHuman.h"
 
@@ -12,10 +15,14 @@ AMPAIControllerCatPlayer::AMPAIControllerCatPlayer()
 void AMPAIControllerCatPlayer::BeginPlay()
 {
     Super::BeginPlay();
-    if (BlackboardComp)
-    {
-        BlackboardComp->SetValueAsEnum(BB_StateKey, static_cast<uint8>(EAICatState::Idle));
-    }
+    SetBBState(static_cast<uint8>(EAICatState::Idle));
+}
+
+void AMPAIControllerCatPlayer::CacheBlackboardKeys()
+{
+    Super::CacheBlackboardKeys();
+    PerceivedHumanKeyId = ResolveBlackboardKey(BB_PerceivedHuman);
+    TargetActorKeyId = ResolveBlackboardKey(BB_TargetActor);
 }
 
 void AMPAIControllerCatPlayer::ChooseNextVoluntaryAction()
@@ -29,10 +36,7 @@ void AMPAIControllerCatPlayer::ChooseNextVoluntaryAction()
     else if ((Acc += ProbInteractHuman) && Rand < Acc) Chosen = EAICatState::InteractHuman;
     else if ((Acc += ProbInteractCat) && Rand < Acc) Chosen = EAICatState::InteractCat;
     else Chosen = EAICatState::PushEnvActor;
-    if (BlackboardComp)
-    {
-        BlackboardComp->SetValueAsEnum(BB_StateKey, static_cast<uint8>(Chosen));
-    }
+    SetBBState(static_cast<uint8>(Chosen));
 
     if (Chosen == EAICatState::Idle)
     {
@@ -55,17 +59,11 @@ void AMPAIControllerCatPlayer::OnPerceptionUpdated(const TArray<AActor*>& Update
     {
         if (Cast<AMPCharacterHuman>(Actor))
         {
-            if (BlackboardComp)
-            {
-                BlackboardComp->SetValueAsBool(BB_PerceivedHuman, true);
-                BlackboardComp->SetValueAsObject(BB_TargetActor, Actor);
-            }
+            SetBBValue<UBlackboardKeyType_Bool>(PerceivedHumanKeyId, true);
+            SetBBValue<UBlackboardKeyType_Object>(TargetActorKeyId, Actor);
             return;
         }
     }
-    if (BlackboardComp)
-    {
-        BlackboardComp->SetValueAsBool(BB_PerceivedHuman, false);
-        BlackboardComp->ClearValue(BB_TargetActor);
-    }
+    SetBBValue<UBlackboardKeyType_Bool>(PerceivedHumanKeyId, false);
+    ClearBBValue(TargetActorKeyId);
 } 
\ No newline at end of file
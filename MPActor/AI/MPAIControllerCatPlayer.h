@@ -60,4 +60,8 @@ protected:
     FName BB_PerceivedHuman = TEXT("PerceivedHuman");
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Blackboard")
     FName BB_TargetActor = TEXT("TargetActor");
+    FBlackboard::FKey PerceivedHumanKeyId = FBlackboard::InvalidKey;
+    FBlackboard::FKey TargetActorKeyId = FBlackboard::InvalidKey;
+
+    virtual void CacheBlackboardKeys() override;
 }; 
\ No newline at end of file
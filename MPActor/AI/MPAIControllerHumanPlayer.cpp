@@ -1,9 +1,14 @@
 #include "MPAIControllerHumanPlayer.h"
 #include "../../CommonEnum.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
 #include "../Character/MPCharacterCat.h"
 #include "Perception/AISense_Hearing.h"
 #include "../Character/MPCharacterHuman.h"
+#include "../../HighLevel/MPWorldRegistry.h"
+#include "MPAISystemManager.h"
 
 
 AMPAIControllerHumanPlayer::AMPAIControllerHumanPlayer()
@@ -18,29 +23,43 @@ void AMPAIControllerHumanPlayer::Tick(float DeltaSeconds)
 void AMPAIControllerHumanPlayer::BeginPlay()
 {
     Super::BeginPlay();
-    if (BlackboardComp)
+    SetBBState(static_cast<uint8>(EAIHumanState::Idle));
+
+    if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
     {
-        BlackboardComp->SetValueAsEnum(BB_StateKey, static_cast<uint8>(EAIHumanState::Idle));
+        registry->RegisterAIHumanController(this);
     }
 }
 
+void AMPAIControllerHumanPlayer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+    {
+        registry->UnregisterAIHumanController(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AMPAIControllerHumanPlayer::CacheBlackboardKeys()
+{
+    Super::CacheBlackboardKeys();
+    PerceivedCatKeyId = ResolveBlackboardKey(BB_PerceivedCat);
+    NoiseLocationKeyId = ResolveBlackboardKey(BB_NoiseLocation);
+    GlobalTaskActorKeyId = ResolveBlackboardKey(BB_GlobalTaskActor);
+}
+
 void AMPAIControllerHumanPlayer::OnPerceptionUpdated(const TArray<AActor*>& UpdatedActors)
 {
     for (AActor* Actor : UpdatedActors)
     {
         if (Cast<AMPCharacterCat>(Actor))
         {
-            if (BlackboardComp)
-            {
-                BlackboardComp->SetValueAsObject(BB_PerceivedCat, Actor);
-            }
+            SetBBValue<UBlackboardKeyType_Object>(PerceivedCatKeyId, Actor);
             return;
         }
     }
-    if (BlackboardComp)
-    {
-        BlackboardComp->ClearValue(BB_PerceivedCat);
-    }
+    ClearBBValue(PerceivedCatKeyId);
 }
 
 void AMPAIControllerHumanPlayer::ChooseNextVoluntaryAction()
@@ -61,7 +80,7 @@ void AMPAIControllerHumanPlayer::ChooseNextVoluntaryAction()
         Chosen = EAIHumanState::InteractContext;
     }
 
-    BlackboardComp->SetValueAsEnum(BB_StateKey, static_cast<uint8>(Chosen));
+    SetBBState(static_cast<uint8>(Chosen));
 }
 
 void AMPAIControllerHumanPlayer::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus)
@@ -72,15 +91,29 @@ void AMPAIControllerHumanPlayer::OnTargetPerceptionUpdated(AActor* Actor, FAISti
         // If Actor is nullptr, this is likely a noise stimulus
         if (Actor == nullptr)
         {
-            if (BlackboardComp)
+            // the search writes the blackboard, so it waits for the AI budget like the rest of perception
+            pendingNoiseLocation = Stimulus.StimulusLocation;
+            hasPendingNoise = true;
+            if (!QueueBudgetedPerception())
             {
-                BlackboardComp->SetValueAsVector(BB_NoiseLocation, Stimulus.StimulusLocation);
-                BlackboardComp->SetValueAsEnum(BB_StateKey, static_cast<uint8>(EAIHumanState::Search));
+                hasPendingNoise = false;
+                StartNoiseSearch(pendingNoiseLocation);
             }
         }
     }
 } 
 
+void AMPAIControllerHumanPlayer::ProcessQueuedPerception()
+{
+    Super::ProcessQueuedPerception();
+
+    if (hasPendingNoise)
+    {
+        hasPendingNoise = false;
+        StartNoiseSearch(pendingNoiseLocation);
+    }
+}
+
 void AMPAIControllerHumanPlayer::SetAISystem(AMPAISystemManager* theManager)
 { 
     AISystem = theManager; 
@@ -95,7 +128,30 @@ void AMPAIControllerHumanPlayer::AssignGlobalTask(AMPEnvActorComp* urgentActor)
 {
     if (BlackboardComp)
     {
-        BlackboardComp->SetValueAsObject(BB_GlobalTaskActor, urgentActor);
+        SetBBValue<UBlackboardKeyType_Object>(GlobalTaskActorKeyId, urgentActor);
         isBeingAssined = true;
     }
+}
+
+void AMPAIControllerHumanPlayer::CompleteGlobalTask()
+{
+    UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (AMPAISystemManager* aiSystem = registry ? registry->GetAISystemManager() : AISystem)
+    {
+        aiSystem->ReleaseUrgentTask(this);
+        return;
+    }
+    ClearGlobalTask();
+}
+
+void AMPAIControllerHumanPlayer::ClearGlobalTask()
+{
+    ClearBBValue(GlobalTaskActorKeyId);
+    isBeingAssined = false;
+}
+
+void AMPAIControllerHumanPlayer::StartNoiseSearch(const FVector& NoiseLocation)
+{
+    SetBBValue<UBlackboardKeyType_Vector>(NoiseLocationKeyId, NoiseLocation);
+    SetBBState(static_cast<uint8>(EAIHumanState::Search));
 }
\ No newline at end of file
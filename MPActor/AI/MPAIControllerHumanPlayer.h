@@ -40,6 +40,7 @@ public:
     AMPAIControllerHumanPlayer();
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaSeconds) override;
 
 
@@ -47,6 +48,10 @@ protected:
     virtual void OnPerceptionUpdated(const TArray<AActor*>& UpdatedActors) override;
     virtual void OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus) override;
 
+    // the latest heard noise, started from ProcessQueuedPerception so the search stays under the AI budget
+    FVector pendingNoiseLocation = FVector::ZeroVector;
+    bool hasPendingNoise = false;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AI|Decision")
     float ProbIdle = 0.2f;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AI|Decision")
@@ -63,6 +68,11 @@ protected:
     FName BB_NoiseLocation = TEXT("NoiseLocation");
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blackboard")
     FName BB_GlobalTaskActor = TEXT("GlobalTaskActor");
+    FBlackboard::FKey PerceivedCatKeyId = FBlackboard::InvalidKey;
+    FBlackboard::FKey NoiseLocationKeyId = FBlackboard::InvalidKey;
+    FBlackboard::FKey GlobalTaskActorKeyId = FBlackboard::InvalidKey;
+
+    virtual void CacheBlackboardKeys() override;
 
     // Decision making
     virtual void ChooseNextVoluntaryAction() override;
@@ -71,12 +81,24 @@ protected:
 	AMPAISystemManager* AISystem = nullptr;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    bool isBeingAssined;
+    bool isBeingAssined = false;
 
 public:
     void SetAISystem(AMPAISystemManager* theManager);
 
+    virtual void ProcessQueuedPerception() override;
+
     bool IsBusyWithGlobalTask();
 
+    // sends the bot to search around a noise, used by its own hearing and by UManagerAIController
+    void StartNoiseSearch(const FVector& NoiseLocation);
+
     void AssignGlobalTask(AMPEnvActorComp* urgentActor);
+
+    // called by the Behavior Tree once the urgent task in GlobalTaskActor is handled, frees the bot for the next one
+    UFUNCTION(BlueprintCallable, Category="AI|System")
+    void CompleteGlobalTask();
+
+    // drops the task without telling the manager, used by the manager itself
+    void ClearGlobalTask();
 }; 
\ No newline at end of file
@@ -3,10 +3,82 @@
 #include "GameFramework/Actor.h"
 #include "../AI/MPAIControllerHumanPlayer.h"
 #include "../EnvActor/MPEnvActorComp.h"
+#include "../../HighLevel/MPWorldRegistry.h"
+#include "../Character/MPCharacterHuman.h"
+#include "../../HighLevel/Managers/ManagerLog.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "NavigationSystem.h"
+#include "TimerManager.h"
+
+DECLARE_STATS_GROUP(TEXT("MPAI"), STATGROUP_MPAI, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("AI Budget Tick"), STAT_MPAIBudgetTick, STATGROUP_MPAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Processed"), STAT_MPAIPerceptionProcessed, STATGROUP_MPAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Merged"), STAT_MPAIPerceptionMerged, STATGROUP_MPAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Changes"), STAT_MPAITierChanges, STATGROUP_MPAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Perception Waiting"), STAT_MPAIPerceptionWaiting, STATGROUP_MPAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bots Near"), STAT_MPAIBotsNear, STATGROUP_MPAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bots Far"), STAT_MPAIBotsFar, STATGROUP_MPAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bots Dormant"), STAT_MPAIBotsDormant, STATGROUP_MPAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Urgent Pending"), STAT_MPAIUrgentPending, STATGROUP_MPAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Urgent Assigned"), STAT_MPAIUrgentAssigned, STATGROUP_MPAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Urgent Path Queries"), STAT_MPAIUrgentPathQueries, STATGROUP_MPAI);
 
 AMPAISystemManager::AMPAISystemManager()
 {
-    PrimaryActorTick.bCanEverTick = false;
+    PrimaryActorTick.bCanEverTick = true;
+}
+
+void AMPAISystemManager::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // bots only exist on the server, so does their budget
+    if (!HasAuthority())
+    {
+        SetActorTickEnabled(false);
+        return;
+    }
+
+    if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+    {
+        registry->RegisterAISystemManager(this);
+    }
+}
+
+void AMPAISystemManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+    {
+        registry->UnregisterAISystemManager(this);
+    }
+    perceptionQueue.Empty();
+    urgentTasks.Empty();
+    GetWorldTimerManager().ClearTimer(benchmarkTimerHandle);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AMPAISystemManager::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+    SCOPE_CYCLE_COUNTER(STAT_MPAIBudgetTick);
+
+    tierTimeAccumulator += DeltaSeconds;
+    if (tierTimeAccumulator >= tierUpdateInterval)
+    {
+        tierTimeAccumulator = 0.0f;
+        UpdateTiers();
+    }
+
+    urgentTimeAccumulator += DeltaSeconds;
+    if (urgentTimeAccumulator >= urgentUpdateInterval)
+    {
+        urgentTimeAccumulator = 0.0f;
+        UpdateUrgentTasks();
+    }
+
+    ProcessPerceptionQueue();
 }
 
 // initialize
@@ -17,27 +89,25 @@ void AMPAISystemManager::Initialize()
 }
 void AMPAISystemManager::LocateAIHumans()
 {
-    TArray<AActor*> allActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMPAIControllerHumanPlayer::StaticClass(), allActors);
+    UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry) return;
 
-    for (AActor* eachActor : allActors)
+    for (AMPAIControllerHumanPlayer* eachHumanController : registry->GetAIHumanControllers())
     {
-        AMPAIControllerHumanPlayer* eachHumanController = Cast<AMPAIControllerHumanPlayer>(eachActor);
         if (eachHumanController)
         {
             eachHumanController->SetAISystem(this);
-            allAIHumanControllers.Add(eachHumanController);
+            allAIHumanControllers.AddUnique(eachHumanController);
         }
     }
 }
 void AMPAISystemManager::LocateUrgentEnvActors()
 {
-    TArray<AActor*> allActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMPEnvActorComp::StaticClass(), allActors);
+    UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry) return;
 
-    for (AActor* eachActor : allActors)
+    for (AMPEnvActorComp* eachEnvActorComp : registry->GetEnvActors())
     {
-        AMPEnvActorComp* eachEnvActorComp = Cast<AMPEnvActorComp>(eachActor);
         if (eachEnvActorComp)
         {
             if (eachEnvActorComp->CheckCanCauseUrgentEvent())
@@ -51,22 +121,397 @@ void AMPAISystemManager::LocateUrgentEnvActors()
 // urgent event
 void AMPAISystemManager::ReceiveUrgentNotification(AMPEnvActorComp* eventActor)
 {
-    if (!allUrgentEnvActor.Contains(eventActor))
+    if (!eventActor) return;
+
+    // an event already waiting or being handled is not queued twice
+    for (const FUrgentTask& eachTask : urgentTasks)
     {
-        allUrgentEnvActor.Add(eventActor);
-        AllocateUrgent();
+        if (eachTask.envActor.Get() == eventActor) return;
     }
+
+    FUrgentTask& newTask = urgentTasks.AddDefaulted_GetRef();
+    newTask.envActor = eventActor;
+    newTask.notifiedTime = GetWorld()->GetTimeSeconds();
+    AllocateUrgent();
+}
+
+void AMPAISystemManager::ReleaseUrgentTask(AMPAIControllerHumanPlayer* humanController)
+{
+    for (int32 index = urgentTasks.Num() - 1; index >= 0; --index)
+    {
+        if (urgentTasks[index].assignee.Get() == humanController)
+        {
+            DropUrgentTask(index);
+        }
+    }
+    if (humanController) humanController->ClearGlobalTask();
+
+    // the freed bot can take the next event right away
+    AllocateUrgent();
+}
+
+void AMPAISystemManager::CancelUrgentEvent(AMPEnvActorComp* eventActor)
+{
+    bool hasFreedBot = false;
+    for (int32 index = urgentTasks.Num() - 1; index >= 0; --index)
+    {
+        if (urgentTasks[index].envActor.Get() != eventActor) continue;
+
+        if (AMPAIControllerHumanPlayer* assignee = urgentTasks[index].assignee.Get())
+        {
+            assignee->ClearGlobalTask();
+            hasFreedBot = true;
+        }
+        DropUrgentTask(index);
+    }
+
+    if (hasFreedBot) AllocateUrgent();
+}
+
+void AMPAISystemManager::DropUrgentTask(int32 taskIndex)
+{
+    // RemoveAt keeps the notification order
+    urgentTasks.RemoveAt(taskIndex, 1, false);
 }
 
 void AMPAISystemManager::AllocateUrgent()
 {
-    // Example: Iterate over all spawned AI characters and trigger an urgent behavior.
-    for (AMPAIControllerHumanPlayer* eachHumanController : allAIHumanControllers)
+    for (FUrgentTask& eachTask : urgentTasks)
+    {
+        if (eachTask.assignee.IsValid()) continue;
+
+        AMPEnvActorComp* eventActor = eachTask.envActor.Get();
+        if (!eventActor) continue;
+
+        // no responder can mean this event is unreachable, later events may still find a free bot
+        AMPAIControllerHumanPlayer* responder = FindBestResponder(eventActor->GetActorLocation());
+        if (!responder)
+        {
+            if (!HasFreeResponder()) break;
+            continue;
+        }
+
+        eachTask.assignee = responder;
+        eachTask.arrivedTime = -1.0f;
+        responder->AssignGlobalTask(eventActor);
+    }
+}
+
+bool AMPAISystemManager::HasFreeResponder() const
+{
+    UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry) return false;
+
+    for (AMPAIControllerHumanPlayer* eachHumanController : registry->GetAIHumanControllers())
+    {
+        if (CanRespondToUrgent(eachHumanController) && !eachHumanController->IsBusyWithGlobalTask()) return true;
+    }
+    return false;
+}
+
+bool AMPAISystemManager::CanRespondToUrgent(const AMPAIControllerHumanPlayer* humanController) const
+{
+    if (!IsValid(humanController)) return false;
+
+    const AMPCharacterHuman* humanPawn = Cast<AMPCharacterHuman>(humanController->GetPawn());
+    return humanPawn && !humanPawn->IsDead();
+}
+
+AMPAIControllerHumanPlayer* AMPAISystemManager::FindBestResponder(const FVector& eventLocation) const
+{
+    UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry) return nullptr;
+
+    // straight line distance first, it is cheap and a lower bound of the path length
+    TArray<TPair<float, AMPAIControllerHumanPlayer*>, TInlineAllocator<16>> candidates;
+    for (AMPAIControllerHumanPlayer* eachHumanController : registry->GetAIHumanControllers())
+    {
+        if (!CanRespondToUrgent(eachHumanController) || eachHumanController->IsBusyWithGlobalTask()) continue;
+
+        const float distanceSquared = FVector::DistSquared(eachHumanController->GetPawn()->GetActorLocation(), eventLocation);
+        candidates.Emplace(distanceSquared, eachHumanController);
+    }
+    if (candidates.Num() == 0) return nullptr;
+
+    candidates.Sort([](const TPair<float, AMPAIControllerHumanPlayer*>& a, const TPair<float, AMPAIControllerHumanPlayer*>& b) { return a.Key < b.Key; });
+
+    UNavigationSystemV1* navSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+    if (!navSystem) return candidates[0].Value;
+
+    AMPAIControllerHumanPlayer* bestResponder = nullptr;
+    FVector::FReal bestPathCost = TNumericLimits<FVector::FReal>::Max();
+    const int32 numPathQueries = FMath::Min(candidates.Num(), FMath::Max(maxPathCostCandidates, 1));
+
+    for (int32 index = 0; index < numPathQueries; ++index)
+    {
+        AMPAIControllerHumanPlayer* candidate = candidates[index].Value;
+        FVector::FReal pathCost = 0.0;
+        INC_DWORD_STAT(STAT_MPAIUrgentPathQueries);
+
+        // an unreachable event is left for a bot that can get there
+        if (navSystem->GetPathCost(candidate->GetPawn()->GetActorLocation(), eventLocation, pathCost) != ENavigationQueryResult::Success) continue;
+
+        if (pathCost < bestPathCost)
+        {
+            bestPathCost = pathCost;
+            bestResponder = candidate;
+        }
+    }
+    return bestResponder;
+}
+
+void AMPAISystemManager::UpdateUrgentTasks()
+{
+    const float now = GetWorld()->GetTimeSeconds();
+    bool hasPendingTask = false;
+    uint32 assignedCount = 0;
+
+    for (int32 index = urgentTasks.Num() - 1; index >= 0; --index)
+    {
+        FUrgentTask& eachTask = urgentTasks[index];
+        AMPEnvActorComp* eventActor = eachTask.envActor.Get();
+        AMPAIControllerHumanPlayer* assignee = eachTask.assignee.Get();
+
+        // the event actor was destroyed (a pooled one cancels itself in OnReleasedToPool), or nobody got there in time
+        if (!eventActor || (eachTask.arrivedTime < 0.0f && now - eachTask.notifiedTime > urgentEventLifetime))
+        {
+            if (isBenchmarkRunning && eventActor) ++benchmarkExpired;
+            if (assignee) assignee->ClearGlobalTask();
+            DropUrgentTask(index);
+            continue;
+        }
+
+        // the bot died or lost its pawn, its event goes to the next one
+        if (assignee && !CanRespondToUrgent(assignee))
+        {
+            assignee->ClearGlobalTask();
+            assignee = nullptr;
+        }
+        if (!assignee)
+        {
+            eachTask.assignee.Reset();
+            eachTask.arrivedTime = -1.0f;
+            hasPendingTask = true;
+            continue;
+        }
+
+        if (eachTask.arrivedTime < 0.0f)
+        {
+            if (FVector::DistSquared(assignee->GetPawn()->GetActorLocation(), eventActor->GetActorLocation()) <= FMath::Square(urgentArrivalDistance))
+            {
+                eachTask.arrivedTime = now;
+                if (isBenchmarkRunning) benchmarkResponseTimes.Add(now - eachTask.notifiedTime);
+            }
+        }
+        else if (now - eachTask.arrivedTime > urgentTaskHoldSeconds)
+        {
+            // the Behavior Tree never reported back, free the bot anyway
+            assignee->ClearGlobalTask();
+            DropUrgentTask(index);
+            continue;
+        }
+        ++assignedCount;
+    }
+
+    if (hasPendingTask) AllocateUrgent();
+
+    SET_DWORD_STAT(STAT_MPAIUrgentPending, urgentTasks.Num() - assignedCount);
+    SET_DWORD_STAT(STAT_MPAIUrgentAssigned, assignedCount);
+
+    if (isBenchmarkRunning && benchmarkEventsLeft == 0 && urgentTasks.Num() == 0)
+    {
+        ReportUrgentBenchmark();
+    }
+}
+
+// urgent benchmark
+void AMPAISystemManager::StartUrgentBenchmark(int32 eventCount, float interval)
+{
+    benchmarkResponseTimes.Reset();
+    benchmarkExpired = 0;
+    benchmarkEventsLeft = FMath::Max(eventCount, 1);
+    isBenchmarkRunning = true;
+
+    GetWorldTimerManager().SetTimer(benchmarkTimerHandle, this, &AMPAISystemManager::FireBenchmarkEvent, FMath::Max(interval, 0.1f), true, 0.0f);
+}
+
+void AMPAISystemManager::FireBenchmarkEvent()
+{
+    UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry || benchmarkEventsLeft <= 0)
+    {
+        GetWorldTimerManager().ClearTimer(benchmarkTimerHandle);
+        return;
+    }
+
+    TArray<AMPEnvActorComp*, TInlineAllocator<32>> urgentEnvActors;
+    for (AMPEnvActorComp* eachEnvActorComp : registry->GetEnvActors())
+    {
+        if (eachEnvActorComp && eachEnvActorComp->CheckCanCauseUrgentEvent()) urgentEnvActors.Add(eachEnvActorComp);
+    }
+    if (urgentEnvActors.Num() == 0)
     {
-        if (eachHumanController && !eachHumanController->IsBusyWithGlobalTask())
+        MP_LOG_WARNING(TEXT("MPAIBenchmark"), TEXT("No env actor on this map can cause an urgent event"));
+        benchmarkEventsLeft = 0;
+        isBenchmarkRunning = false;
+        GetWorldTimerManager().ClearTimer(benchmarkTimerHandle);
+        return;
+    }
+
+    ReceiveUrgentNotification(urgentEnvActors[FMath::RandRange(0, urgentEnvActors.Num() - 1)]);
+    if (--benchmarkEventsLeft == 0)
+    {
+        GetWorldTimerManager().ClearTimer(benchmarkTimerHandle);
+    }
+}
+
+void AMPAISystemManager::ReportUrgentBenchmark()
+{
+    isBenchmarkRunning = false;
+
+    const int32 answered = benchmarkResponseTimes.Num();
+    if (answered == 0)
+    {
+        MP_LOG_INFO(TEXT("MPAIBenchmark"), TEXT("Urgent response: no event was reached, %d expired"), benchmarkExpired);
+        return;
+    }
+
+    benchmarkResponseTimes.Sort();
+    float totalTime = 0.0f;
+    for (const float eachTime : benchmarkResponseTimes) totalTime += eachTime;
+
+    MP_LOG_INFO(TEXT("MPAIBenchmark"), TEXT("Urgent response over %d events (%d expired): mean %.2f s, p95 %.2f s, max %.2f s"),
+        answered + benchmarkExpired, benchmarkExpired, totalTime / answered,
+        benchmarkResponseTimes[FMath::Min(answered - 1, FMath::FloorToInt(answered * 0.95f))], benchmarkResponseTimes.Last());
+}
+
+// mp.AI.UrgentBenchmark [Events] [Interval], during gameplay with human bots spawned
+static FAutoConsoleCommandWithWorldAndArgs GMPAIUrgentBenchmarkCommand(
+    TEXT("mp.AI.UrgentBenchmark"),
+    TEXT("Server only. Fires urgent events on random urgent env actors and logs the mean / p95 / max time until a human bot reaches them. Usage: mp.AI.UrgentBenchmark [Events=20] [Interval=2]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& args, UWorld* world)
+    {
+        UMPWorldRegistry* registry = world ? world->GetSubsystem<UMPWorldRegistry>() : nullptr;
+        AMPAISystemManager* aiSystem = registry ? registry->GetAISystemManager() : nullptr;
+        if (!aiSystem)
         {
-            eachHumanController->AssignGlobalTask(allUrgentEnvActor.Last());
-            break;
+            MP_LOG_WARNING(TEXT("MPAIBenchmark"), TEXT("mp.AI.UrgentBenchmark needs a running match on the server"));
+            return;
         }
+
+        const int32 eventCount = args.Num() > 0 ? FCString::Atoi(*args[0]) : 20;
+        const float interval = args.Num() > 1 ? FCString::Atof(*args[1]) : 2.0f;
+        aiSystem->StartUrgentBenchmark(eventCount, interval);
+        MP_LOG_INFO(TEXT("MPAIBenchmark"), TEXT("Firing %d urgent events, one every %.1f s"), eventCount, interval);
+    }));
+
+// AI budget
+void AMPAISystemManager::QueuePerceptionUpdate(AMPAIController* aiController)
+{
+    if (!aiController) return;
+
+    // the deferred update reads the current perception state, so a second callback before it runs adds nothing
+    if (perceptionQueue.Contains(aiController))
+    {
+        INC_DWORD_STAT(STAT_MPAIPerceptionMerged);
+        return;
     }
-}
\ No newline at end of file
+    perceptionQueue.Add(aiController);
+}
+
+void AMPAISystemManager::ProcessPerceptionQueue()
+{
+    int32 budget = maxPerceptionUpdatesPerFrame;
+
+    // near bots first, then whoever has waited longest
+    for (int32 pass = 0; pass < 2 && budget > 0; ++pass)
+    {
+        for (int32 index = 0; index < perceptionQueue.Num() && budget > 0;)
+        {
+            AMPAIController* aiController = perceptionQueue[index].Get();
+            if (!aiController)
+            {
+                perceptionQueue.RemoveAt(index, 1, false);
+                continue;
+            }
+            if (pass == 0 && aiController->GetBudgetTier() != EAIBudgetTier::Near)
+            {
+                ++index;
+                continue;
+            }
+
+            // removed before running, the update may queue the same bot again
+            perceptionQueue.RemoveAt(index, 1, false);
+            aiController->ProcessQueuedPerception();
+            INC_DWORD_STAT(STAT_MPAIPerceptionProcessed);
+            --budget;
+        }
+    }
+
+    SET_DWORD_STAT(STAT_MPAIPerceptionWaiting, perceptionQueue.Num());
+}
+
+void AMPAISystemManager::UpdateTiers()
+{
+    UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+    if (!registry) return;
+
+    playerLocationScratch.Reset();
+    for (FConstPlayerControllerIterator iterator = GetWorld()->GetPlayerControllerIterator(); iterator; ++iterator)
+    {
+        const APlayerController* playerController = iterator->Get();
+        if (const APawn* playerPawn = playerController ? playerController->GetPawn() : nullptr)
+        {
+            playerLocationScratch.Add(playerPawn->GetActorLocation());
+        }
+    }
+
+    uint32 tierCounts[3] = { 0, 0, 0 };
+    int32 changesLeft = maxTierChangesPerUpdate;
+
+    for (AMPAIController* aiController : registry->GetAIControllers())
+    {
+        if (!IsValid(aiController)) continue;
+
+        EAIBudgetTier tier = aiController->GetBudgetTier();
+        const EAIBudgetTier wantedTier = ComputeTier(aiController);
+        if (wantedTier != tier && changesLeft > 0)
+        {
+            // the rest catch up on the next update
+            --changesLeft;
+            tier = wantedTier;
+
+            float tickInterval = 0.0f;
+            if (tier == EAIBudgetTier::Far) tickInterval = farTickInterval;
+            else if (tier == EAIBudgetTier::Dormant) tickInterval = dormantTickInterval;
+
+            aiController->SetBudgetTier(tier, tickInterval);
+            INC_DWORD_STAT(STAT_MPAITierChanges);
+        }
+
+        ++tierCounts[static_cast<uint8>(tier)];
+    }
+
+    SET_DWORD_STAT(STAT_MPAIBotsNear, tierCounts[0]);
+    SET_DWORD_STAT(STAT_MPAIBotsFar, tierCounts[1]);
+    SET_DWORD_STAT(STAT_MPAIBotsDormant, tierCounts[2]);
+}
+
+EAIBudgetTier AMPAISystemManager::ComputeTier(const AMPAIController* aiController) const
+{
+    const APawn* botPawn = aiController->GetPawn();
+
+    // no players to measure from (a bot-only test map), leave everyone at full rate
+    if (!botPawn || playerLocationScratch.Num() == 0) return EAIBudgetTier::Near;
+
+    const FVector botLocation = botPawn->GetActorLocation();
+    float nearestDistanceSquared = MAX_flt;
+    for (const FVector& playerLocation : playerLocationScratch)
+    {
+        nearestDistanceSquared = FMath::Min(nearestDistanceSquared, FVector::DistSquared(botLocation, playerLocation));
+    }
+
+    if (nearestDistanceSquared < FMath::Square(farDistance)) return EAIBudgetTier::Near;
+    if (nearestDistanceSquared < FMath::Square(dormantDistance)) return EAIBudgetTier::Far;
+    return EAIBudgetTier::Dormant;
+}
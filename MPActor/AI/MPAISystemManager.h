@@ -5,7 +5,14 @@
 // This is a high-level singleton-like actor that manages the overall AI ecosystem.
 // It keeps track of all active AI Human controllers and is aware of special "urgent"
 // environmental actors. Its primary role is to receive notifications about urgent events
-// and delegate those tasks to an available AI.
+// and delegate those tasks to an available AI. Each pending event goes to the free human bot with
+// the cheapest navmesh path to it. A bot is freed when it finishes the task or dies, and its event
+// then goes to the next bot. Events that nobody reached within `urgentEventLifetime` are dropped.
+// It also owns the AI budget on the server. Every bot gets a tier from its distance to the nearest
+// player pawn. Far and dormant bots tick less often; sight stays on for all of them, only processed slower.
+// Perception updates are queued, merged per bot, and processed a few per frame, nearest bots first.
+// At most `maxTierChangesPerUpdate` bots change tier in one update, so a player crossing a crowd
+// does not re-tune every bot's ticks in the same frame.
 //
 // How to utilize in Blueprint:
 // 1. There should be exactly ONE instance of this actor (or a Blueprint derived from it) placed in the gameplay level.
@@ -15,17 +22,25 @@
 //
 // Necessary things to define:
 // - A single instance of a Blueprint derived from this class must be placed in the level for it to function.
+// - Optional tuning of the budget in the "AI Budget" category: distances, tick intervals, per-frame caps and `tierUpdateInterval`.
 //
 // How it interacts with other classes:
 // - AActor: It is an actor that exists in the level, making it easy for other actors to find and reference.
-// - AMPAIControllerHumanPlayer: It maintains a list of all human AI controllers in the game, which it populates by searching the level in `LocateAIHumans`.
-// - AMPEnvActorComp: It specifically tracks environmental actors that are marked as "urgent". When one of these actors fires a notification, the manager's `AllocateUrgent` function finds a free AI from its list and assigns the task to it.
+// - AMPAIControllerHumanPlayer: It maintains a list of all human AI controllers in the game, which it populates from the `UMPWorldRegistry` in `LocateAIHumans`.
+// - AMPEnvActorComp: It specifically tracks environmental actors that are marked as "urgent". When one of these actors fires a notification, the manager queues an urgent task for it, and `AllocateUrgent` assigns pending tasks to free bots. Only the `maxPathCostCandidates` bots nearest in a straight line are path-tested.
+// - AMPAIControllerHumanPlayer: Gets the task through `AssignGlobalTask`. The Behavior Tree calls `CompleteGlobalTask` when the bot is done. A bot that reaches the event and never reports back is freed after `urgentTaskHoldSeconds`.
+// - `mp.AI.UrgentBenchmark [Events] [Interval]`: Server console command. It fires urgent events on random urgent env actors and logs the mean, p95 and max time from event to a bot reaching it, plus how many events expired.
+// - AMPAIController: Registers with `UMPWorldRegistry`, and its perception callback calls `QueuePerceptionUpdate`. The manager calls `ProcessQueuedPerception` and `SetBudgetTier` on it.
+// - UMPWorldRegistry: The manager registers itself there, which is how AI controllers find it.
+// - `stat MPAI`: Bots per tier, queued, processed and merged perception updates, tier changes, and the budget tick time.
 // - UManagerAIController (in `HighLevel/Managers`): There is a tight coupling here. The `UManagerAIController` is responsible for spawning the AI controllers, and this `AMPAISystemManager` is responsible for finding them in the level and giving them high-level tasks. The `UManagerAIController` likely holds a reference to this actor.
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "../../CommonEnum.h"
 #include "MPAISystemManager.generated.h"
 
+class AMPAIController;
 class AMPAIControllerHumanPlayer;
 class AMPEnvActorComp;
 
@@ -37,6 +52,10 @@ class AMPAISystemManager : public AActor
 public:
     AMPAISystemManager();
 
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void Tick(float DeltaSeconds) override;
+
 public:
     UFUNCTION(BlueprintCallable, Category="AI Manager")
     void Initialize();
@@ -51,15 +70,94 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="AI Manager")
         TArray<AMPAIControllerHumanPlayer*> allAIHumanControllers;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="AI Manager")
-        TArray<AMPEnvActorComp*> allUrgentEnvActor;
-    
     // urgent event
 public :
     UFUNCTION(BlueprintCallable, Category="AI Manager")
         void ReceiveUrgentNotification(AMPEnvActorComp* eventActor);
 
+    // the bot is done with its urgent task, or can no longer do it; frees the bot and the event
+    void ReleaseUrgentTask(AMPAIControllerHumanPlayer* humanController);
+
+    // the event actor went back to its pool, nobody should walk to the parking spot
+    void CancelUrgentEvent(AMPEnvActorComp* eventActor);
+
+    int32 GetNumUrgentTasks() const { return urgentTasks.Num(); }
+
+    // fires eventCount urgent events, one per interval, and logs the response times once they are resolved
+    void StartUrgentBenchmark(int32 eventCount, float interval);
+
 protected :
     UFUNCTION(BlueprintCallable, Category="AI Manager")
         void AllocateUrgent();
+
+    UPROPERTY(EditAnywhere, Category="Urgent Event")
+        float urgentEventLifetime = 30.0f;
+    UPROPERTY(EditAnywhere, Category="Urgent Event")
+        float urgentTaskHoldSeconds = 5.0f;
+    UPROPERTY(EditAnywhere, Category="Urgent Event")
+        float urgentArrivalDistance = 250.0f;
+    UPROPERTY(EditAnywhere, Category="Urgent Event")
+        float urgentUpdateInterval = 0.25f;
+    // path queries are the expensive part, only this many of the nearest free bots get one
+    UPROPERTY(EditAnywhere, Category="Urgent Event")
+        int32 maxPathCostCandidates = 4;
+
+    struct FUrgentTask
+    {
+        TWeakObjectPtr<AMPEnvActorComp> envActor;
+        TWeakObjectPtr<AMPAIControllerHumanPlayer> assignee;
+        float notifiedTime = 0.0f;
+        // negative until the assignee reaches the event
+        float arrivedTime = -1.0f;
+    };
+
+    // in notification order, so the oldest event is served first
+    TArray<FUrgentTask> urgentTasks;
+    float urgentTimeAccumulator = 0.0f;
+
+    void UpdateUrgentTasks();
+    void DropUrgentTask(int32 taskIndex);
+    // possesses a human that is still alive
+    bool CanRespondToUrgent(const AMPAIControllerHumanPlayer* humanController) const;
+    bool HasFreeResponder() const;
+    AMPAIControllerHumanPlayer* FindBestResponder(const FVector& eventLocation) const;
+
+    // urgent benchmark
+    TArray<float> benchmarkResponseTimes;
+    int32 benchmarkEventsLeft = 0;
+    int32 benchmarkExpired = 0;
+    bool isBenchmarkRunning = false;
+    FTimerHandle benchmarkTimerHandle;
+
+    void FireBenchmarkEvent();
+    void ReportUrgentBenchmark();
+
+    // AI budget
+public:
+    // called from a bot's perception callback, the update runs later within the per-frame budget
+    void QueuePerceptionUpdate(AMPAIController* aiController);
+
+protected:
+    UPROPERTY(EditAnywhere, Category="AI Budget")
+        int32 maxPerceptionUpdatesPerFrame = 4;
+    UPROPERTY(EditAnywhere, Category="AI Budget")
+        int32 maxTierChangesPerUpdate = 4;
+    UPROPERTY(EditAnywhere, Category="AI Budget")
+        float tierUpdateInterval = 0.5f;
+    UPROPERTY(EditAnywhere, Category="AI Budget")
+        float farDistance = 4000.0f;
+    UPROPERTY(EditAnywhere, Category="AI Budget")
+        float dormantDistance = 8000.0f;
+    UPROPERTY(EditAnywhere, Category="AI Budget")
+        float farTickInterval = 0.1f;
+    UPROPERTY(EditAnywhere, Category="AI Budget")
+        float dormantTickInterval = 0.5f;
+
+    TArray<TWeakObjectPtr<AMPAIController>> perceptionQueue;
+    TArray<FVector> playerLocationScratch;
+    float tierTimeAccumulator = 0.0f;
+
+    void UpdateTiers();
+    EAIBudgetTier ComputeTier(const AMPAIController* aiController) const;
+    void ProcessPerceptionQueue();
 };
\ No newline at end of file
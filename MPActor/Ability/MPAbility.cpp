@@ -3,11 +3,16 @@
 #include "../../CommonEnum.h"
 #include "../../CommonStruct.h"
 #include "../Character/MPCharacterCat.h"
+#include "../../HighLevel/MPGMGameplay.h"
+#include "../../HighLevel/MPReplicationGraph.h"
+#include "Kismet/GameplayStatics.h"
 
 
 AMPAbility::AMPAbility()
 {
 	bReplicates = true;
+	// only the cat using it needs its state
+	bOnlyRelevantToOwner = true;
 }
 
 void AMPAbility::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -16,6 +21,8 @@ void AMPAbility::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifeti
 
     DOREPLIFETIME(AMPAbility, isBeingUse);
     DOREPLIFETIME(AMPAbility, isInCooldown);
+    DOREPLIFETIME(AMPAbility, usageEndServerTime);
+    DOREPLIFETIME(AMPAbility, cooldownEndServerTime);
 }
 
 void AMPAbility::OnRep_BeingUse() {}
@@ -26,6 +33,18 @@ void AMPAbility::BeInitialized(AMPCharacterCat* player)
 {
 	abilityOwner = player;
 	ownerWorld = abilityOwner->GetWorld();
+	SetAbilityNetOwner(player);
+}
+
+void AMPAbility::SetAbilityNetOwner(AActor* newOwner)
+{
+	if (!HasAuthority() || GetOwner() == newOwner) return;
+
+	SetOwner(newOwner);
+	if (UMPReplicationGraph* replicationGraph = UMPReplicationGraph::Get(GetWorld()))
+	{
+		replicationGraph->NotifyNetOwnerChanged(this);
+	}
 }
 
 EAbility AMPAbility::GetAbilityTag()
@@ -77,45 +96,33 @@ void AMPAbility::StartUsageEffectDuration(AActor* targetActor)
 {
 	isBeingUse = true;
 	targetActorSaved = targetActor;
-	curUsageCountDown = totalUsageDuration;
-
-	ApplyUsageEffectDuration();
-}
 
-void AMPAbility::ApplyUsageEffectDuration()
-{
 	ApplyUsageEffectDurationEffect();
-	ApplyUsageEffectDurationCountdown();
+
+	UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(ownerWorld);
+	if (!scheduler || totalUsageDuration <= 0)
+	{
+		ExpireUsageEffectDuration();
+		return;
+	}
+
+	usageEndServerTime = scheduler->GetServerTime() + totalUsageDuration;
+	scheduler->Cancel(usageEffectHandle);
+	usageEffectHandle = scheduler->Schedule(usageEndServerTime,
+		FSimpleDelegate::CreateUObject(this, &AMPAbility::ExpireUsageEffectDuration),
+		1.0f, FSimpleDelegate::CreateUObject(this, &AMPAbility::ApplyUsageEffectDurationEffect));
 }
+
 void AMPAbility::ApplyUsageEffectDurationEffect()
 {
 	// effect ...
 }
-void AMPAbility::ApplyUsageEffectDurationCountdown()
-{
-	if (curUsageCountDown > 0)
-	{
-		if (ownerWorld)
-		{	
-			curUsageCountDown -= 1;
-
-			ownerWorld->GetTimerManager().ClearTimer(usageTimerHandle);
-			FTimerDelegate usageTimerDel;
-			usageTimerDel.BindUFunction(this, FName("ApplyUsageEffectDuration"));
-			ownerWorld->GetTimerManager().SetTimer(usageTimerHandle,
-				usageTimerDel, 1, false);
-		}
-	}
-	else 
-	{
-		ExpireUsageEffectDuration();
-	}
-}
 
 void AMPAbility::ExpireUsageEffectDuration()
 {
 	isBeingUse = false;
 	targetActorSaved = nullptr;
+	usageEffectHandle.Invalidate();
 
 	StartCooldown();
 }
@@ -123,31 +130,68 @@ void AMPAbility::ExpireUsageEffectDuration()
 void AMPAbility::StartCooldown()
 {
 	isInCooldown = true;
-	curCooldownCountDown = totalCooldown;
-	CooldownCountDown();
-}
 
-void AMPAbility::CooldownCountDown()
-{
-	if (curCooldownCountDown > 0)
-	{
-		if (ownerWorld)
-		{	
-			curCooldownCountDown -=1;
-
-			ownerWorld->GetTimerManager().ClearTimer(cooldownTimerHandle);
-			FTimerDelegate usageCooldownTimerDel;
-			usageCooldownTimerDel.BindUFunction(this, FName("CooldownCountDown"));
-			ownerWorld->GetTimerManager().SetTimer(cooldownTimerHandle,
-				usageCooldownTimerDel, totalCooldown, false);
-		}
-	}
-	else 
+	UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(ownerWorld);
+	if (!scheduler || totalCooldown <= 0)
 	{
 		EndCooldown();
+		return;
 	}
+
+	cooldownEndServerTime = scheduler->GetServerTime() + totalCooldown;
+	scheduler->Cancel(cooldownEffectHandle);
+	cooldownEffectHandle = scheduler->Schedule(cooldownEndServerTime,
+		FSimpleDelegate::CreateUObject(this, &AMPAbility::EndCooldown));
 }
+
 void AMPAbility::EndCooldown()
 {
 	isInCooldown = false;
+	cooldownEffectHandle.Invalidate();
+}
+
+float AMPAbility::GetUsageRemainingTime() const
+{
+	if (!isBeingUse) return 0.0f;
+	return FMath::Max(usageEndServerTime - UMPEffectScheduler::GetServerTime(GetWorld()), 0.0f);
+}
+
+float AMPAbility::GetCooldownRemainingTime() const
+{
+	if (!isInCooldown) return 0.0f;
+	return FMath::Max(cooldownEndServerTime - UMPEffectScheduler::GetServerTime(GetWorld()), 0.0f);
+}
+
+void AMPAbility::GetEliminated()
+{
+	AMPGMGameplay* mpGameMode = Cast<AMPGMGameplay>(UGameplayStatics::GetGameMode(GetWorld()));
+	if (mpGameMode && mpGameMode->ReleaseAbility(this))
+	{
+		return;
+	}
+	Destroy();
+}
+
+void AMPAbility::OnAcquiredFromPool()
+{
+	// BeInitialized sets the new owner right after the factory hands the ability out
+	return;
+}
+
+void AMPAbility::OnReleasedToPool()
+{
+	if (UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(ownerWorld))
+	{
+		scheduler->Cancel(usageEffectHandle);
+		scheduler->Cancel(cooldownEffectHandle);
+	}
+
+	isBeingUse = false;
+	isInCooldown = false;
+	targetActorSaved = nullptr;
+	usageEndServerTime = 0.0f;
+	cooldownEndServerTime = 0.0f;
+	abilityOwner = nullptr;
+	ownerWorld = nullptr;
+	SetAbilityNetOwner(nullptr);
 }
\ No newline at end of file
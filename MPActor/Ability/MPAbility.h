@@ -26,14 +26,16 @@
 // How it interacts with other classes:
 // - AActor: It is an actor that exists in the world.
 // - AMPCharacterCat: The `abilityOwner` is typically a cat character. The ability holds a reference to its owner.
-// - UFactoryAbility: This factory is responsible for spawning instances of `AMPAbility` blueprints.
-// - Replication: Key boolean flags (`isBeingUse`, `isInCooldown`) are replicated so that clients can visually represent the ability's state (e.g., greying out an icon on the HUD). `OnRep_` functions are used to trigger these visual updates.
-// - FTimerManager: It relies heavily on timers to manage the duration and cooldown countdowns.
+// - UFactoryAbility: This factory is responsible for spawning instances of `AMPAbility` blueprints. `GetEliminated` returns the ability to the factory pool when pooling is enabled.
+// - Replication: Key boolean flags (`isBeingUse`, `isInCooldown`) are replicated so that clients can visually represent the ability's state (e.g., greying out an icon on the HUD). `OnRep_` functions are used to trigger these visual updates. The ability is only relevant to its owner: `BeInitialized` makes the cat its actor owner, and `UMPReplicationGraph` routes it to that player's connection only.
+// - UMPEffectScheduler: Runs the usage duration (with a pulse every second) and the cooldown. Only their end timestamps are replicated; `GetUsageRemainingTime` / `GetCooldownRemainingTime` derive the countdown from them.
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 
 #include "TimerManager.h"
+#include "../../HighLevel/MPEffectScheduler.h"
+#include "../MPPoolable.h"
 
 #include "MPAbility.generated.h"
 
@@ -42,7 +44,7 @@ class AMPCharacterCat;
 class AActor;
 
 UCLASS(BlueprintType, Blueprintable)
-class AMPAbility : public AActor
+class AMPAbility : public AActor, public IMPPoolable
 {
     GENERATED_BODY()
 
@@ -62,6 +64,9 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Common Properties")
     UWorld* ownerWorld;
 
+    // server only, sets the actor owner and re-routes the ability in the replication graph
+    void SetAbilityNetOwner(AActor* newOwner);
+
 public:
     /* BeInitialized
     * this->SetOwner(player);
@@ -92,18 +97,19 @@ protected:
     AActor* targetActorSaved = nullptr;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Usage Properties")
     float totalUsageDuration;
-    UPROPERTY(BlueprintReadWrite, Category = "Cooldown Properties")
-    float curUsageCountDown;
+    // server time the usage window ends, see UMPEffectScheduler
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Usage Properties")
+    float usageEndServerTime = 0.0f;
     
-    FTimerHandle usageTimerHandle;
+    FMPEffectHandle usageEffectHandle;
 
     // cooldown
     UPROPERTY(BlueprintReadWrite, Category = "Cooldown Properties")
     float totalCooldown;
-    UPROPERTY(BlueprintReadWrite, Category = "Cooldown Properties")
-    float curCooldownCountDown;
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Cooldown Properties")
+    float cooldownEndServerTime = 0.0f;
     
-    FTimerHandle cooldownTimerHandle;
+    FMPEffectHandle cooldownEffectHandle;
 
 public:
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
@@ -118,20 +124,28 @@ public:
 
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
     void StartUsageEffectDuration(AActor* targetActor);
-    UFUNCTION(BlueprintCallable, Category = "Usage Method")
-    void ApplyUsageEffectDuration();
+    // applied once when the usage starts and again every second until it expires
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
     virtual void ApplyUsageEffectDurationEffect();
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
-    void ApplyUsageEffectDurationCountdown();
-    UFUNCTION(BlueprintCallable, Category = "Usage Method")
     void ExpireUsageEffectDuration();
 
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
     void StartCooldown();
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
-    void CooldownCountDown();
-    UFUNCTION(BlueprintCallable, Category = "Usage Method")
     void EndCooldown();
 
+    // derived from the replicated end timestamps, valid on server and clients
+    UFUNCTION(BlueprintCallable, Category = "Usage Method")
+    float GetUsageRemainingTime() const;
+    UFUNCTION(BlueprintCallable, Category = "Usage Method")
+    float GetCooldownRemainingTime() const;
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "Usage Method")
+    void GetEliminated();
+
+    // IMPPoolable
+    virtual void OnAcquiredFromPool() override;
+    virtual void OnReleasedToPool() override;
 };
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Sound/SoundCue.h"
 #include "Components/SceneComponent.h"
 #include "GameFramework/HUD.h"
@@ -14,6 +15,9 @@
 #include "../../CommonStruct.h"
 #include "../../HighLevel/Managers/ManagerLog.h"
 #include "../../HighLevel/MPGMGameplay.h"
+#include "../../HighLevel/MPWorldRegistry.h"
+#include "../../HighLevel/MPSoundEventChannel.h"
+#include "../../HighLevel/MPCharacterSignificance.h"
 
 #include "../Player/MPControllerPlayer.h"
 #include "../Player/MPPlayerState.h"
@@ -23,6 +27,10 @@
 
 #include "MotionWarpingComponent.h"
 
+DECLARE_STATS_GROUP(TEXT("MPDetect"), STATGROUP_MPDetect, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Detect traces issued"), STAT_MPDetectTracesIssued, STATGROUP_MPDetect);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Detect traces skipped"), STAT_MPDetectTracesSkipped, STATGROUP_MPDetect);
+
 AMPCharacter::AMPCharacter()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -53,34 +61,72 @@ void AMPCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLife
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	// Replicate critical properties for multiplayer
-	DOREPLIFETIME(AMPCharacter, inventory);
-	DOREPLIFETIME(AMPCharacter, curHoldingItemIndex);
-	DOREPLIFETIME(AMPCharacter, curHoldingItem);
-	DOREPLIFETIME(AMPCharacter, curSpeed);
-	DOREPLIFETIME(AMPCharacter, isDoingAnAnimation);
-	DOREPLIFETIME(AMPCharacter, bIsStunned);
+	// push model: only sent after the owning setter marked the property dirty
+	FDoRepLifetimeParams pushParams;
+	pushParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPCharacter, inventory, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPCharacter, curHoldingItemIndex, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPCharacter, curHoldingItem, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPCharacter, curSpeed, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPCharacter, isDoingAnAnimation, pushParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMPCharacter, bIsStunned, pushParams);
 }
 
 void AMPCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	ResolveHintTextHandles();
+
 	InitializeItems();
+
+	detectTraceDelegate.BindUObject(this, &AMPCharacter::OnDetectTraceCompleted);
+
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->RegisterCharacter(this);
+	}
+}
+
+void AMPCharacter::EndPlay(const EEndPlayReason::Type endPlayReason)
+{
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(endPlayReason);
 }
 
 void AMPCharacter::Tick(float deltaTime)
 {
 	Super::Tick(deltaTime);
 
+	UMPCharacterSignificance::CountCharacterTick(significance);
+
 	// Only perform detection on the controlling client or server
 	if (HasAuthority() || IsLocallyControlled())
 	{
-		Detect();
+		TickDetect(deltaTime);
 	}
 	
 	UpdateMovingControlsPerTick(deltaTime);
 }
 
+// significance
+void AMPCharacter::SetSignificance(ECharacterSignificance newSignificance, float actorTickInterval, float animTickInterval)
+{
+	significance = newSignificance;
+	SetActorTickInterval(actorTickInterval);
+
+	// the server and the owner need full-rate root motion and sockets, only a simulated proxy's animation is cosmetic
+	if (GetLocalRole() == ROLE_SimulatedProxy && GetMesh())
+	{
+		GetMesh()->SetComponentTickInterval(animTickInterval);
+	}
+}
+
 // interactable interface
 bool AMPCharacter::IsInteractable(AMPCharacter* player)
 {
@@ -91,11 +137,20 @@ FText AMPCharacter::GetInteractHintText(AMPCharacter* player)
 {
 	if (IsInteractable(player))
 	{
-		return UManagerLocalization::GetInstance()->GetLocalizedText(interactHintTextKey);
+		return UManagerLocalization::GetInstance()->GetLocalizedTextByHandleOrKey(interactHintTextHandle, interactHintTextKey);
 	}
 	else
 	{
-		return UManagerLocalization::GetInstance()->GetLocalizedText(uninteractableHintTextKey);
+		return UManagerLocalization::GetInstance()->GetLocalizedTextByHandleOrKey(uninteractableHintTextHandle, uninteractableHintTextKey);
+	}
+}
+
+void AMPCharacter::ResolveHintTextHandles()
+{
+	if (UManagerLocalization* localization = UManagerLocalization::GetInstance())
+	{
+		interactHintTextHandle = localization->FindTextHandle(FName(*interactHintTextKey));
+		uninteractableHintTextHandle = localization->FindTextHandle(FName(*uninteractableHintTextKey));
 	}
 }
 
@@ -114,23 +169,43 @@ void AMPCharacter::PlaySoundLocally(USoundCue* aSound)
 
 void AMPCharacter::PlaySoundBroadcast(USoundCue* aSound)
 {
-	PlaySoundServer(aSound);
+	UMPSoundEventChannel::BroadcastSound(this, aSound, GetActorLocation());
 }
 
-void AMPCharacter::PlaySoundServer_Implementation(USoundCue* aSound)
+// detect 
+void AMPCharacter::TickDetect(float deltaTime)
 {
-	if (HasAuthority())
-    {
-		PlaySoundMulticast(aSound);
+	if (!IsValid(characterCamera))
+	{
+		return;
 	}
-}
 
-void AMPCharacter::PlaySoundMulticast_Implementation(USoundCue* aSound)
-{
-	PlaySoundLocally(aSound);
+	detectTimeAccumulator += deltaTime;
+	detectIdleTime += deltaTime;
+
+	// bots only need the detected actor when their behavior tree asks to interact
+	const float curDetectInterval = IsPlayerControlled() ? detectInterval : aiDetectInterval;
+	if (detectTimeAccumulator < curDetectInterval || isDetectTracePending)
+	{
+		return;
+	}
+	detectTimeAccumulator = 0.0f;
+
+	const FVector cameraLocation = characterCamera->GetComponentLocation();
+	const FVector cameraDirection = characterCamera->GetForwardVector();
+	const bool isCameraStill = cameraLocation.Equals(lastDetectStart, detectMoveTolerance)
+		&& cameraDirection.Equals(lastDetectDirection, KINDA_SMALL_NUMBER);
+
+	if (isCameraStill && detectIdleTime < detectIdleRefreshInterval)
+	{
+		INC_DWORD_STAT(STAT_MPDetectTracesSkipped);
+		return;
+	}
+
+	detectIdleTime = 0.0f;
+	Detect();
 }
 
-// detect 
 void AMPCharacter::Detect()
 {
 	if (!IsValid(characterCamera)) 
@@ -141,9 +216,37 @@ void AMPCharacter::Detect()
 	detectStart = characterCamera->GetComponentLocation();
 	detectDirection = characterCamera->GetForwardVector();
 	detectEnd = ((detectDirection * detectDistance) + detectStart);
+	lastDetectStart = detectStart;
+	lastDetectDirection = detectDirection;
+
+	INC_DWORD_STAT(STAT_MPDetectTracesIssued);
+
+	if (useAsyncDetect)
+	{
+		isDetectTracePending = true;
+		GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, detectStart, detectEnd, ECC_Visibility,
+			DefaultComponentQueryParams, DefaultResponseParam, &detectTraceDelegate);
+		return;
+	}
 	
 	bool bHit = GetWorld()->LineTraceSingleByChannel(detectHit, detectStart, detectEnd, ECC_Visibility, DefaultComponentQueryParams, DefaultResponseParam);
 
+	DrawDetectDebugLine(bHit);
+	DetectReaction();
+}
+
+void AMPCharacter::OnDetectTraceCompleted(const FTraceHandle& traceHandle, FTraceDatum& traceData)
+{
+	isDetectTracePending = false;
+
+	detectHit = traceData.OutHits.Num() > 0 ? traceData.OutHits[0] : FHitResult();
+
+	DrawDetectDebugLine(detectHit.bBlockingHit);
+	DetectReaction();
+}
+
+void AMPCharacter::DrawDetectDebugLine(bool bHit)
+{
 	if (isAbleToFireTraceLine)
 	{
 		FColor LineColor = bHit ? FColor::Green : FColor::Red;
@@ -158,7 +261,6 @@ void AMPCharacter::Detect()
 			2.0f         // Thickness
 		);
 	}
-	DetectReaction();
 }
 
 void AMPCharacter::DetectReaction()
@@ -186,13 +288,14 @@ void AMPCharacter::DetectReaction()
             detectedActor = hitActor;
             if (IMPInteractable* interactable = Cast<IMPInteractable>(hitActor))
             {
-                curDetectHintText = interactable->GetInteractHintText(this);
+                RefreshDetectHintText(hitActor, interactable);
             }
             return;
         }
         else
         {
             curDetectHintText = detectInvalidHintText;
+            hintCachedActor = nullptr;
             return;
         }
     }
@@ -200,11 +303,34 @@ void AMPCharacter::DetectReaction()
     {
         // No hit at all
         curDetectHintText = detectInvalidHintText;
+        hintCachedActor = nullptr;
         detectInteractableActor = nullptr;
         detectedActor = nullptr;
     }
 }
 
+void AMPCharacter::RefreshDetectHintText(AActor* hitActor, IMPInteractable* interactable)
+{
+    UManagerLocalization* localization = UManagerLocalization::GetInstance();
+    const ELanguage curLanguage = localization ? localization->GetCurrentLanguage() : ELanguage::Max;
+    const uint32 actorVersion = interactable->GetInteractableVersion();
+
+    if (hintCachedActor.Get() == hitActor
+        && hintCachedActorVersion == actorVersion
+        && hintCachedSelfVersion == interactableVersion
+        && hintCachedLanguage == curLanguage)
+    {
+        return;
+    }
+
+    curDetectHintText = interactable->GetInteractHintText(this);
+
+    hintCachedActor = hitActor;
+    hintCachedActorVersion = actorVersion;
+    hintCachedSelfVersion = interactableVersion;
+    hintCachedLanguage = curLanguage;
+}
+
 // controller/ input reaction
 void AMPCharacter::PossessedBy(AController* newController)
 {
@@ -248,28 +374,24 @@ void AMPCharacter::Run()
 {
 	if (!CheckIfIsAbleToRun()) return;
 
-	curSpeed = runSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(runSpeed);
 }
 
 void AMPCharacter::RunStop()
 {
-	curSpeed = moveSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(moveSpeed);
 }
 
 void AMPCharacter::CrouchStart()
 {
 	if (!CheckIfIsAbleToCrouch()) return;
 
-	curSpeed = crouchSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(crouchSpeed);
 }
 
 void AMPCharacter::CrouchEnd()
 {
-	curSpeed = moveSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(moveSpeed);
 }
 
 void AMPCharacter::JumpStart()
@@ -346,9 +468,10 @@ void AMPCharacter::UpdateMovingControlsPerTick(float deltaTime)
 	return;
 }
 
-void AMPCharacter::UpdateSpeed()
+void AMPCharacter::UpdateSpeed(int32 baseSpeed)
 {
-	curSpeed = moveSpeed + extraSpeed;
+	curSpeed = baseSpeed + extraSpeed;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPCharacter, curSpeed, this);
 	
 	// Update character movement speed
 	if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
@@ -361,6 +484,7 @@ void AMPCharacter::UpdateSpeed()
 void AMPCharacter::InitializeItems()
 {
 	inventory.Empty();
+	MarkInventoryDirty();
 	for (EMPItem eachItemTag : initItems)
 	{
 		AddAnItem(eachItemTag);
@@ -398,7 +522,8 @@ void AMPCharacter::AddAnItem(EMPItem aItemTag)
 			newItem->BePickedUp(this);
 			
 			inventory.Add(newItem);
-			UManagerLog::LogDebug(FString::Printf(TEXT("Added item to inventory: %d"), static_cast<int32>(aItemTag)), TEXT("MPCharacter"));
+			MarkInventoryDirty();
+			MP_LOG_DEBUG(TEXT("MPCharacter"), TEXT("Added item to inventory: %d"), static_cast<int32>(aItemTag));
 			// Directly update HUD after adding item
 			if (APlayerController* PC = Cast<APlayerController>(GetController())) {
 				if (PC->IsLocalController()) {
@@ -438,6 +563,7 @@ void AMPCharacter::PickupAnItem(AMPItem* aItem)
 	{
 		aItem->BePickedUp(this);
 		inventory.Add(aItem);
+		MarkInventoryDirty();
 		UManagerLog::LogInfo(TEXT("Item picked up successfully"), TEXT("MPCharacter"));
 	}
 	else
@@ -459,18 +585,18 @@ void AMPCharacter::DeleteItem(AMPItem* itemToDelete)
 	{
 		// Remove from inventory
 		inventory.RemoveAt(deleteItemIndex);
+		MarkInventoryDirty();
 		
 		// If this was the currently held item, clear it
 		if (curHoldingItem == itemToDelete)
 		{
-			curHoldingItem = nullptr;
-			curHoldingItemIndex = -1;
+			SetHoldingItem(-1, nullptr);
 		}
 		
-		// Destroy the item
+		// Destroy the item (or hand it back to the item pool)
 		if (IsValid(itemToDelete))
 		{
-			itemToDelete->Destroy();
+			itemToDelete->GetEliminated();
 		}
 		
 		UManagerLog::LogInfo(TEXT("Item deleted from inventory"), TEXT("MPCharacter"));
@@ -543,8 +669,7 @@ void AMPCharacter::SelectItem(int32 itemIndex)
         return;
     }
 
-    curHoldingItemIndex = itemIndex;
-    curHoldingItem = inventory[itemIndex];
+    SetHoldingItem(itemIndex, inventory[itemIndex]);
     // Directly update HUD after selection
     if (APlayerController* PC = Cast<APlayerController>(GetController())) {
         if (PC->IsLocalController()) {
@@ -554,13 +679,12 @@ void AMPCharacter::SelectItem(int32 itemIndex)
             }
         }
     }
-    UManagerLog::LogInfo(FString::Printf(TEXT("Selected item at index %d"), itemIndex), TEXT("MPCharacter"));
+    MP_LOG_INFO(TEXT("MPCharacter"), TEXT("Selected item at index %d"), itemIndex);
 }
 
 void AMPCharacter::UnselectCurItem()
 {
-    curHoldingItemIndex = -1;
-    curHoldingItem = nullptr;
+    SetHoldingItem(-1, nullptr);
     // Directly update HUD after unselect
     if (APlayerController* PC = Cast<APlayerController>(GetController())) {
         if (PC->IsLocalController()) {
@@ -573,6 +697,19 @@ void AMPCharacter::UnselectCurItem()
     UManagerLog::LogInfo(TEXT("Unselected current item"), TEXT("MPCharacter"));
 }
 
+void AMPCharacter::SetHoldingItem(int32 itemIndex, AMPItem* item)
+{
+	curHoldingItemIndex = itemIndex;
+	curHoldingItem = item;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPCharacter, curHoldingItemIndex, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPCharacter, curHoldingItem, this);
+}
+
+void AMPCharacter::MarkInventoryDirty()
+{
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPCharacter, inventory, this);
+}
+
 void AMPCharacter::UseCurItem()
 {
 	if (!IsAbleToUseCurItem()) return;
@@ -593,8 +730,7 @@ void AMPCharacter::DropCurItem()
 	if (!IsValid(curHoldingItem)) return;
 
 	curHoldingItem->BeDroped(this);
-	curHoldingItem = nullptr;
-	curHoldingItemIndex = -1;
+	SetHoldingItem(-1, nullptr);
 	
 	UManagerLog::LogInfo(TEXT("Dropped current item"), TEXT("MPCharacter"));
 	// Directly update HUD after dropping item
@@ -621,6 +757,11 @@ void AMPCharacter::SetAir(EAirState newAirState)
 	return;
 }
 
+EMoveState AMPCharacter::GetSimulatedMoveState() const
+{
+	return GetVelocity().SizeSquared2D() > FMath::Square(simulatedWalkSpeedThreshold) ? EMoveState::Walk : EMoveState::Idle;
+}
+
 // animation context/ montage
 void AMPCharacter::PlayContextAnimationMontage()
 {
@@ -653,7 +794,7 @@ void AMPCharacter::PlaySelectedMontage(UAnimMontage* chosenMontage, float playRa
 
 	// Play the montage
 	animInstance->Montage_Play(chosenMontage, playRate);
-	isDoingAnAnimation = true;
+	SetIsDoingAnAnimation(true);
 	
 	animInstance->OnMontageEnded.AddUniqueDynamic(this, &AMPCharacter::OnMontageEnded);
 
@@ -662,10 +803,10 @@ void AMPCharacter::PlaySelectedMontage(UAnimMontage* chosenMontage, float playRa
 
 void AMPCharacter::OnMontageEnded(UAnimMontage* montage, bool bInterrupted)
 {
-	isDoingAnAnimation = false;
+	SetIsDoingAnAnimation(false);
 	OnMontageEndedContextClear(montage, bInterrupted);
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Animation montage ended - Interrupted: %s"), bInterrupted ? TEXT("Yes") : TEXT("No")), TEXT("MPCharacter"));
+	MP_LOG_DEBUG(TEXT("MPCharacter"), TEXT("Animation montage ended - Interrupted: %s"), bInterrupted ? TEXT("Yes") : TEXT("No"));
 }
 
 void AMPCharacter::OnMontageEndedContextClear(UAnimMontage* montage, bool bInterrupted)
@@ -676,6 +817,14 @@ void AMPCharacter::OnMontageEndedContextClear(UAnimMontage* montage, bool bInter
 }
 
 
+void AMPCharacter::SetIsDoingAnAnimation(bool bDoingAnimation)
+{
+	if (isDoingAnAnimation == bDoingAnimation) return;
+
+	isDoingAnAnimation = bDoingAnimation;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPCharacter, isDoingAnAnimation, this);
+}
+
 void AMPCharacter::OnRep_IsDoingAnimation()
 {
 	// Handle animation state changes on clients
@@ -686,22 +835,28 @@ void AMPCharacter::BeStunned(int32 stunDuration)
 {
 	if (bIsStunned) return;
 
-	bIsStunned = true;
+	SetIsStunned(true);
 	
 	// Set timer to clear stun
 	GetWorld()->GetTimerManager().SetTimer(stunTimerHandle, this, &AMPCharacter::StopStunned, stunDuration, false);
 	
-	UManagerLog::LogInfo(FString::Printf(TEXT("Character stunned for %d seconds"), stunDuration), TEXT("MPCharacter"));
+	MP_LOG_INFO(TEXT("MPCharacter"), TEXT("Character stunned for %d seconds"), stunDuration);
 }
 
 void AMPCharacter::StopStunned()
 {
-	bIsStunned = false;
+	SetIsStunned(false);
 	GetWorld()->GetTimerManager().ClearTimer(stunTimerHandle);
 	
 	UManagerLog::LogInfo(TEXT("Character unstunned"), TEXT("MPCharacter"));
 }
 
+void AMPCharacter::SetIsStunned(bool bStunned)
+{
+	bIsStunned = bStunned;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPCharacter, bIsStunned, this);
+}
+
 void AMPCharacter::OnRep_IsStunned()
 {
 	// Handle stun state changes on clients
@@ -8,7 +8,7 @@
 // - **Movement**: Standard character movement (walking, running, crouching, jumping) with replicated speed values.
 // - **Inventory**: A basic inventory system for picking up, holding, using, and dropping items.
 // - **Animation**: A framework for playing animation montages and managing animation states.
-// - **Sound**: An interface for playing local and replicated sounds.
+// - **Sound**: An interface for playing local sounds and broadcasting them through UMPSoundEventChannel.
 // - **Status Effects**: A system for handling conditions like being stunned.
 //
 // How to utilize in Blueprint:
@@ -20,7 +20,10 @@
 // Necessary things to define:
 // - While this class has many properties, most are configured in the child classes (`AMPCharacterCat`, `AMPCharacterHuman`) or set at runtime.
 // - The `initItems` array can be populated in a child Blueprint to give a character items at spawn.
-// - `detectDistance` can be tweaked in child Blueprints.
+// - The hint text of the looked-at actor is cached and only resolved again when the actor, its `GetInteractableVersion`, this character's own version or the language changes.
+// - Replication is push-based: `curSpeed`, `inventory`, the holding item, `isDoingAnAnimation` and `bIsStunned` are only written through `UpdateSpeed`, `SetHoldingItem`, `SetIsDoingAnAnimation`, `SetIsStunned` and the inventory functions, which mark them dirty.
+// - `detectDistance` can be tweaked in child Blueprints, and so can the detect rates (`detectInterval`, `aiDetectInterval`). The interaction trace runs asynchronously at that rate and is skipped while the camera has not moved; `stat MPDetect` shows traces issued vs skipped.
+// - UMPCharacterSignificance: Ranks the character and sets its tick interval through `SetSignificance`. `deltaTime` then spans the whole interval, so timers driven by it stay correct.
 //
 // How it interacts with other classes:
 // - ACharacter: Inherits from the standard Unreal character class.
@@ -33,9 +36,11 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "../../CommonEnum.h"
 #include "../MPInteractable.h"
 #include "../MPPlaySoundInterface.h"
 #include "UObject/ScriptInterface.h"
+#include "WorldCollision.h"
 
 #include "MPCharacter.generated.h"
 
@@ -61,8 +66,20 @@ public :
     
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type endPlayReason) override;
     virtual void Tick(float deltaTime) override;
 
+// 1.1 significance
+public :
+    ECharacterSignificance GetSignificance() const { return significance; }
+    // called by UMPCharacterSignificance when the bucket changes
+    void SetSignificance(ECharacterSignificance newSignificance, float actorTickInterval, float animTickInterval);
+    // hand targets and simulated air / move state are only worth updating while someone may see them
+    bool ShouldTickCosmetics() const { return significance != ECharacterSignificance::Minimal; }
+
+protected :
+    ECharacterSignificance significance = ECharacterSignificance::High;
+
 // 2. interface
 // 2.1 interactable
 public :
@@ -75,18 +92,22 @@ public :
     virtual FText GetInteractHintText(AMPCharacter* player) override;
     virtual void BeInteracted(AMPCharacter* player) override;
 
+    virtual uint32 GetInteractableVersion() const override { return interactableVersion; }
+    void MarkInteractableDirty() { ++interactableVersion; }
+
+protected:
+    uint32 interactableVersion = 0;
+
+    // resolved once in BeginPlay, INDEX_NONE falls back to the key lookup
+    int32 interactHintTextHandle = INDEX_NONE;
+    int32 uninteractableHintTextHandle = INDEX_NONE;
+    void ResolveHintTextHandles();
+
 // 2.2 play sound
 public:
     virtual void PlaySoundLocally(USoundCue* aSound) override;
     virtual void PlaySoundBroadcast(USoundCue* aSound) override;
 
-protected:
-    UFUNCTION(Server, Reliable)
-        void PlaySoundServer(USoundCue* aSound);
-            
-    UFUNCTION(NetMulticast, Reliable)
-        void PlaySoundMulticast(USoundCue* aSound);
-
 // 3. components
 // 3.1 camera component
 	/* camera 
@@ -113,6 +134,30 @@ protected :
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detect Properties")
         float detectDistance = 300.0f; // Added default value
+
+    // async traces land one frame later, the sync path is kept for debugging
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detect Properties")
+        bool useAsyncDetect = true;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detect Properties")
+        float detectInterval = 0.05f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detect Properties")
+        float aiDetectInterval = 0.5f;
+    // even with a still camera, re-trace this often so moving or changing targets are noticed
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detect Properties")
+        float detectIdleRefreshInterval = 0.5f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detect Properties")
+        float detectMoveTolerance = 1.0f;
+
+    float detectTimeAccumulator = 0.0f;
+    float detectIdleTime = 0.0f;
+    FVector lastDetectStart = FVector::ZeroVector;
+    FVector lastDetectDirection = FVector::ZeroVector;
+    bool isDetectTracePending = false;
+    FTraceDelegate detectTraceDelegate;
+
+    void TickDetect(float deltaTime);
+    void OnDetectTraceCompleted(const FTraceHandle& traceHandle, FTraceDatum& traceData);
+    void DrawDetectDebugLine(bool bHit);
     
     UPROPERTY(BlueprintReadWrite, Category = "Detect Properties")
         FVector detectStart;
@@ -133,11 +178,19 @@ protected :
     UPROPERTY(BlueprintReadOnly, Category = "Common Properties")
         FText curDetectHintText; // detect hint text (for objects that are not interactable but are mpactors)
 
+    // what curDetectHintText was resolved for, DetectReaction skips the lookup while none of it changes
+    TWeakObjectPtr<AActor> hintCachedActor;
+    uint32 hintCachedActorVersion = 0;
+    uint32 hintCachedSelfVersion = 0;
+    ELanguage hintCachedLanguage = ELanguage::Max;
+
     UFUNCTION(BlueprintCallable, Category = "Detect Method")
         void Detect(); // calculate and fire the hit
     UFUNCTION(BlueprintCallable, Category = "Detect Method")
         void DetectReaction(); // determinate the current interaction
 
+    void RefreshDetectHintText(AActor* hitActor, IMPInteractable* interactable);
+
     UFUNCTION()
         void OnRep_AbleToInteract();
 
@@ -197,7 +250,7 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Control Method")
     virtual void UpdateMovingControlsPerTick(float deltaTime);
 
-    UPROPERTY(ReplicatedUsing = OnRep_CurSpeed, BlueprintReadWrite, Category = "Control Properties")
+    UPROPERTY(ReplicatedUsing = OnRep_CurSpeed, BlueprintReadOnly, Category = "Control Properties")
         int32 curSpeed = 0; // Added default value
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Control Properties")
         int32 moveSpeed = 600; // Added default value
@@ -208,8 +261,9 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Control Properties")
         int32 extraSpeed = 0; // Added default value
 
+    // the only writer of curSpeed, extraSpeed is added on top of baseSpeed
     UFUNCTION(BlueprintCallable, Category = "Control Method")
-        void UpdateSpeed();
+        void UpdateSpeed(int32 baseSpeed);
     
     UFUNCTION()
         void OnRep_CurSpeed();
@@ -218,16 +272,19 @@ protected:
 protected :
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory Properties")
         TArray<EMPItem> initItems;
-    UPROPERTY(Replicated, BlueprintReadWrite, Category = "Inventory Properties")
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Inventory Properties")
         TArray<AMPItem*> inventory;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory Properties")
         int32 inventoryCapacity = 10; // Added default value
     
-    UPROPERTY(ReplicatedUsing = OnRep_CurHoldingItemIndex, BlueprintReadWrite, Category = "Inventory Properties")
+    UPROPERTY(ReplicatedUsing = OnRep_CurHoldingItemIndex, BlueprintReadOnly, Category = "Inventory Properties")
         int32 curHoldingItemIndex = -1;
-    UPROPERTY(ReplicatedUsing = OnRep_CurHoldingItem, BlueprintReadWrite, Category = "Inventory Properties")
+    UPROPERTY(ReplicatedUsing = OnRep_CurHoldingItem, BlueprintReadOnly, Category = "Inventory Properties")
         AMPItem* curHoldingItem = nullptr; // Added null initialization
 
+    void SetHoldingItem(int32 itemIndex, AMPItem* item);
+    void MarkInventoryDirty();
+
     UFUNCTION(BlueprintCallable, Category = "Inventory Method")
         void InitializeItems();
     UFUNCTION(BlueprintCallable, Category = "Inventory Method")
@@ -261,7 +318,12 @@ protected:
     virtual void SetMove(EMoveState newMove);
     virtual void SetAir(EAirState newAir);
 
-    UPROPERTY(ReplicatedUsing = OnRep_IsDoingAnimation, BlueprintReadWrite, Category = "Animation Properties")
+    // simulated proxies only receive whether the character runs, idle / walk come from the replicated velocity
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation Properties")
+        float simulatedWalkSpeedThreshold = 10.0f;
+    EMoveState GetSimulatedMoveState() const;
+
+    UPROPERTY(ReplicatedUsing = OnRep_IsDoingAnimation, BlueprintReadOnly, Category = "Animation Properties")
         bool isDoingAnAnimation = false;
     UFUNCTION()
         void OnRep_IsDoingAnimation();
@@ -280,13 +342,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Animation Methods")
     bool IsPlayerInAnimation() const { return isDoingAnAnimation; }    
     UFUNCTION(BlueprintCallable, Category = "Animation Methods")
-    void SetIsDoingAnAnimation(bool bDoingAnimation) { isDoingAnAnimation = bDoingAnimation; }
+    void SetIsDoingAnAnimation(bool bDoingAnimation);
 
 // 7. special condition
 public:
     // Stun system
-    UPROPERTY(ReplicatedUsing = OnRep_IsStunned, BlueprintReadWrite, Category = "Stun Properties")
+    UPROPERTY(ReplicatedUsing = OnRep_IsStunned, BlueprintReadOnly, Category = "Stun Properties")
     bool bIsStunned = false;
+
+    void SetIsStunned(bool bStunned);
     
     FTimerHandle stunTimerHandle; // Timer for clearing stunned state
 
@@ -111,6 +111,12 @@ void AMPCharacterCat::Tick(float deltaTime)
 		
 		bWasGroundedLastTick = bIsGrounded;
 	}
+
+	// the running flag is replicated, idle / walk is not
+	if (GetLocalRole() == ROLE_SimulatedProxy && animState.curMove != EMoveState::Run && ShouldTickCosmetics())
+	{
+		SetMove(GetSimulatedMoveState());
+	}
 }
 
 // 2.interface
@@ -204,29 +210,25 @@ void AMPCharacterCat::Run()
 {
 	if (!CheckIfIsAbleToRun()) return;
 
-	curSpeed = runSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(runSpeed);
 	SetMove(EMoveState::Run);
 }
 
 void AMPCharacterCat::RunStop()
 {
-	curSpeed = moveSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(moveSpeed);
 	SetMove(EMoveState::Walk);
 }
 void AMPCharacterCat::CrouchStart()
 {
 	if (!CheckIfIsAbleToCrouch()) return;
     
-	curSpeed = crouchSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(crouchSpeed);
     SetPosture(ECatPosture::Crouching);
 }
 void AMPCharacterCat::CrouchEnd()
 {
-	curSpeed = moveSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(moveSpeed);
     SetPosture(ECatPosture::Standing);
 }
 void AMPCharacterCat::JumpStart()
@@ -518,6 +520,7 @@ void AMPCharacterCat::SetInteraction(ECatInteractionState newInteraction)
 	if (animState.curInteraction != newInteraction)
 {
     animState.curInteraction = newInteraction;
+		MarkInteractableDirty();
 	}
 }
 
@@ -537,10 +540,14 @@ void AMPCharacterCat::IdlePoseTimeout()
 	// Start the timer again
 	BeginIdlePoseTimer();
 }
-void AMPCharacterCat::OnRep_AnimState()
+void AMPCharacterCat::OnRep_AnimState(const FCatAnimState& oldAnimState)
 {
 	// Handle animation state replication on clients
 	// This will be called when the server updates the animation state
+	if (oldAnimState.curInteraction != animState.curInteraction)
+	{
+		MarkInteractableDirty();
+	}
 }
 
 // 6.2 animation context/ montage
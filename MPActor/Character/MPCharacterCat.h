@@ -27,7 +27,7 @@
 // - AMPCharacterHuman: Has special interactions with the human character, such as being held (`StartedToBeHold`) or rubbed (`StartToBeRubbed`). The human character is the one who initiates these interactions.
 // - AMPAbility: The character initializes and uses active and passive abilities.
 // - FCatAnimState (Struct): This struct is the core of the cat's animation system. This class sets the values in the struct, and the Animation Blueprint reads them to play the correct animations.
-// - Replication: `FCatAnimState` and the `struggleBar` are replicated, ensuring that all clients see the cat's animations and struggle progress correctly.
+// - Replication: `FCatAnimState` and the `struggleBar` are replicated, ensuring that all clients see the cat's animations and struggle progress correctly. The anim state is bit-packed and only carries posture, context, interaction and the running flag; `Tick` derives the air state and idle/walk from replicated movement on every client.
 
 #include "CoreMinimal.h"
 #include "MPCharacter.h"
@@ -235,7 +235,7 @@ protected:
     void IdlePoseTimeout();
 
     UFUNCTION()
-    void OnRep_AnimState();
+    void OnRep_AnimState(const FCatAnimState& oldAnimState);
 
     UFUNCTION(BlueprintPure, Category="AnimState")
     const FCatAnimState& GetAnimState() const { return animState; }
@@ -10,6 +10,7 @@
 #include "../../CommonEnum.h"
 #include "../../CommonStruct.h"
 #include "../../HighLevel/Managers/ManagerLog.h"
+#include "../../HighLevel/MPGMGameplay.h"
 
 #include "../Player/MPControllerPlayer.h"
 #include "../Player/MPPlayerState.h"
@@ -78,7 +79,10 @@ void AMPCharacterHuman::Tick(float deltaTime)
 {
 	Super::Tick(deltaTime);
 
-	updateHoldAnimHandTargets();
+	if (ShouldTickCosmetics())
+	{
+		updateHoldAnimHandTargets();
+	}
 }
 
 // 2. interface
@@ -124,7 +128,7 @@ void AMPCharacterHuman::TakeHealthDamage(int32 damageAmount)
 
 	currentHealth = FMath::Max(0, currentHealth - damageAmount);
 	
-	UManagerLog::LogInfo(FString::Printf(TEXT("Human took %d damage! Health: %d/%d"), damageAmount, currentHealth, maxHealth), TEXT("MPCharacterHuman"));
+	MP_LOG_INFO(TEXT("MPCharacterHuman"), TEXT("Human took %d damage! Health: %d/%d"), damageAmount, currentHealth, maxHealth);
 	
 	if (currentHealth <= 0)
 	{
@@ -138,7 +142,7 @@ void AMPCharacterHuman::HealHealth(int32 healAmount)
 
 	currentHealth = FMath::Min(maxHealth, currentHealth + healAmount);
 	
-	UManagerLog::LogInfo(FString::Printf(TEXT("Human healed %d health! Health: %d/%d"), healAmount, currentHealth, maxHealth), TEXT("MPCharacterHuman"));
+	MP_LOG_INFO(TEXT("MPCharacterHuman"), TEXT("Human healed %d health! Health: %d/%d"), healAmount, currentHealth, maxHealth);
 }
 
 void AMPCharacterHuman::Die()
@@ -168,8 +172,7 @@ void AMPCharacterHuman::Die()
 		{
 			if (AMPControllerPlayer* playerController = Cast<AMPControllerPlayer>(GetController()))
 			{
-				// Handle player death in game mode
-				// mpGameMode->HandlePlayerDeath(playerController);
+				mpGameMode->RegisterHumanDeath();
 			}
 		}
 	}
@@ -178,7 +181,7 @@ void AMPCharacterHuman::Die()
 // Replication callbacks
 void AMPCharacterHuman::OnRep_Health()
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Client: Human health updated to %d/%d"), currentHealth, maxHealth), TEXT("MPCharacterHuman"));
+	MP_LOG_INFO(TEXT("MPCharacterHuman"), TEXT("Client: Human health updated to %d/%d"), currentHealth, maxHealth);
 }
 void AMPCharacterHuman::OnRep_IsDead()
 {
@@ -217,15 +220,13 @@ void AMPCharacterHuman::Run()
 {
 	if (!CheckIfIsAbleToRun()) return;
 
-	curSpeed = runSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(runSpeed);
 	SetMove(EMoveState::Run);
 }
 
 void AMPCharacterHuman::RunStop()
 {
-	curSpeed = moveSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(moveSpeed);
 	SetMove(EMoveState::Walk);
 }
 
@@ -233,15 +234,13 @@ void AMPCharacterHuman::CrouchStart()
 {
 	if (!CheckIfIsAbleToCrouch()) return;
 
-	curSpeed = crouchSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(crouchSpeed);
 	SetPosture(EHumanPosture::Crouching);
 }
 
 void AMPCharacterHuman::CrouchEnd()
 {
-	curSpeed = moveSpeed + extraSpeed;
-	UpdateSpeed();
+	UpdateSpeed(moveSpeed);
 	SetPosture(EHumanPosture::Standing);
 }
 
@@ -311,6 +310,9 @@ bool AMPCharacterHuman::CheckIfIsAbleToJump()
 void AMPCharacterHuman::UpdateMovingControlsPerTick(float deltaTime)
 {
 	Super::UpdateMovingControlsPerTick(deltaTime);
+
+	// the air state only feeds the anim blueprint
+	if (!ShouldTickCosmetics()) return;
 	
 	// Update air state tracking
 	if (UCharacterMovementComponent* MovementComp = GetCharacterMovement())
@@ -333,6 +335,12 @@ void AMPCharacterHuman::UpdateMovingControlsPerTick(float deltaTime)
 			}
 		}
 	}
+
+	// the running flag is replicated, idle / walk is not
+	if (GetLocalRole() == ROLE_SimulatedProxy && animState.curMove != EMoveState::Run)
+	{
+		SetMove(GetSimulatedMoveState());
+	}
 }
 
 // 5.5 interaction related
@@ -482,13 +490,18 @@ void AMPCharacterHuman::SetInteraction(EHumanInteractionState newInteraction)
 	if (animState.curInteraction != newInteraction)
 	{
 		animState.curInteraction = newInteraction;
+		MarkInteractableDirty();
 	}
 }
 
-void AMPCharacterHuman::OnRep_AnimState()
+void AMPCharacterHuman::OnRep_AnimState(const FHumanAnimState& oldAnimState)
 {
 	// Handle animation state replication on clients
 	// This will be called when the server updates the animation state
+	if (oldAnimState.curInteraction != animState.curInteraction)
+	{
+		MarkInteractableDirty();
+	}
 }
 
 // 6.2 animation context/ montage
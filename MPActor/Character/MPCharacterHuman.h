@@ -27,7 +27,7 @@
 // - AMPCharacterCat: The primary target of the human's special interactions. The human can call functions on the cat, like `StartedToBeHold`, and the cat can call functions back, like `Straggle`, which results in the human calling `ForceReleaseCat`.
 // - UMotionWarpingComponent: Used extensively in `holdAnimSnapping` to align the human's animation to the cat being held, making the interaction look natural regardless of the exact positions.
 // - FHumanAnimState (Struct): Contains all the replicated state variables needed to drive the human's animation blueprint.
-// - Replication: `currentHealth`, `isDead`, and `animState` are all replicated to ensure clients have an accurate view of the human's status and animations.
+// - Replication: `currentHealth`, `isDead`, and `animState` are all replicated to ensure clients have an accurate view of the human's status and animations. The anim state is bit-packed and only carries posture, context, interaction and the running flag; `UpdateMovingControlsPerTick` derives the air state and idle/walk from replicated movement on every client.
 
 #include "CoreMinimal.h"
 #include "MPCharacter.h"
@@ -188,7 +188,7 @@ protected:
     void SetInteraction(EHumanInteractionState newInteraction);
     
     UFUNCTION()
-    void OnRep_AnimState();
+    void OnRep_AnimState(const FHumanAnimState& oldAnimState);
 
     UFUNCTION(BlueprintPure, Category="AnimState")
     const FHumanAnimState& GetAnimState() const { return animState; }
@@ -1,5 +1,6 @@
 #include "MPEnvActorComp.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 #include "Components/StaticMeshComponent.h"
 #include "Components/BoxComponent.h"
@@ -8,6 +9,9 @@
 
 #include "../../CommonStruct.h"
 #include "../AI/MPAISystemManager.h"
+#include "../../HighLevel/MPGMGameplay.h"
+#include "../../HighLevel/MPWorldRegistry.h"
+#include "../../HighLevel/MPSoundEventChannel.h"
 
 #include "Sound/SoundCue.h"
 #include "Kismet/GameplayStatics.h"
@@ -16,6 +20,7 @@ AMPEnvActorComp::AMPEnvActorComp()
 {
 	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
+	NetDormancy = DORM_DormantAll;
 
     // Setup scene root
     envActorSceneRoot = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
@@ -30,6 +35,33 @@ AMPEnvActorComp::AMPEnvActorComp()
     envActorAudioComp->SetupAttachment(RootComponent);
 }
 
+void AMPEnvActorComp::BeginPlay()
+{
+	Super::BeginPlay();
+
+	ResolveHintTextHandles();
+
+	if (!useNetDormancy && HasAuthority())
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->RegisterEnvActor(this);
+	}
+}
+
+void AMPEnvActorComp::EndPlay(const EEndPlayReason::Type endPlayReason)
+{
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->UnregisterEnvActor(this);
+	}
+
+	Super::EndPlay(endPlayReason);
+}
+
 void AMPEnvActorComp::BeRandomized()
 {
 	return;
@@ -44,11 +76,20 @@ FText AMPEnvActorComp::GetInteractHintText(AMPCharacter* targetActor)
 {
 	if (IsInteractable(targetActor))
 	{
-		return UManagerLocalization::GetInstance()->GetLocalizedText(interactHintTextKey);
+		return UManagerLocalization::GetInstance()->GetLocalizedTextByHandleOrKey(interactHintTextHandle, interactHintTextKey);
 	}
 	else
 	{
-		return UManagerLocalization::GetInstance()->GetLocalizedText(uninteractableHintTextKey);
+		return UManagerLocalization::GetInstance()->GetLocalizedTextByHandleOrKey(uninteractableHintTextHandle, uninteractableHintTextKey);
+	}
+}
+
+void AMPEnvActorComp::ResolveHintTextHandles()
+{
+	if (UManagerLocalization* localization = UManagerLocalization::GetInstance())
+	{
+		interactHintTextHandle = localization->FindTextHandle(FName(*interactHintTextKey));
+		uninteractableHintTextHandle = localization->FindTextHandle(FName(*uninteractableHintTextKey));
 	}
 }
 
@@ -58,6 +99,8 @@ void AMPEnvActorComp::BeInteracted(AMPCharacter* targetActor)
 
 	if (IsInteractable(targetActor))
 	{
+		WakeNetDormancy();
+
 		switch (envActorType)
 		{
 			case EEnvActorType::EDirectInteract:
@@ -79,9 +122,12 @@ void AMPEnvActorComp::BeInteracted(AMPCharacter* targetActor)
 				break;
 		}
 
-		if (isAbleToCauseUrgentEvent && theAISystem)
+		if (isAbleToCauseUrgentEvent)
 		{
-			theAISystem->ReceiveUrgentNotification(this);
+			if (AMPAISystemManager* aiSystem = FindAISystemManager())
+			{
+				aiSystem->ReceiveUrgentNotification(this);
+			}
 		}
 	}
 }
@@ -95,7 +141,7 @@ void AMPEnvActorComp::EndInteractEffectDirect(AMPCharacter* targetActor)
 {
 	if (isSingleUse)
 	{
-		Destroy();
+		GetEliminated();
 	}
 	else 
 	{
@@ -105,88 +151,199 @@ void AMPEnvActorComp::EndInteractEffectDirect(AMPCharacter* targetActor)
 
 void AMPEnvActorComp::StartInteractEffectDuration(AMPCharacter* targetActor)
 {
-	isInteracting = true;
+	SetIsInteracting(true);
 	interactedCharacter = targetActor;
-	curInteractCountDown = totalInteractDuration;
-
-	ApplyInteractEffectDuration();
-}
 
-void AMPEnvActorComp::ApplyInteractEffectDuration()
-{
 	ApplyInteractEffectDurationEffect();
-	ApplyInteractEffectDurationCountdown();
+
+	UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(this);
+	if (!scheduler || totalInteractDuration <= 0)
+	{
+		ExpireInteractEffectDuration();
+		return;
+	}
+
+	interactEndServerTime = scheduler->GetServerTime() + totalInteractDuration;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPEnvActorComp, interactEndServerTime, this);
+	scheduler->Cancel(interactEffectHandle);
+	interactEffectHandle = scheduler->Schedule(interactEndServerTime,
+		FSimpleDelegate::CreateUObject(this, &AMPEnvActorComp::ExpireInteractEffectDuration),
+		1.0f, FSimpleDelegate::CreateUObject(this, &AMPEnvActorComp::ApplyInteractEffectDurationEffect));
 }
+
 void AMPEnvActorComp::ApplyInteractEffectDurationEffect()
 {
 	// override to apply effect
 }
-void AMPEnvActorComp::ApplyInteractEffectDurationCountdown()
+
+void AMPEnvActorComp::ExpireInteractEffectDuration()
 {
-	if (curInteractCountDown > 0)
+	SetIsInteracting(false);
+	interactedCharacter = nullptr;
+	interactEffectHandle.Invalidate();
+
+	if (isSingleUse)
 	{
-		UWorld* serverWorld = GetWorld();
-		if (serverWorld)
-		{	
-			curInteractCountDown -= 1;
-
-			serverWorld->GetTimerManager().ClearTimer(interactTimerHandle);
-			FTimerDelegate interactTimerDel;
-			interactTimerDel.BindUFunction(this, FName("ApplyInteractEffectDuration"));
-			serverWorld->GetTimerManager().SetTimer(interactTimerHandle, 
-				interactTimerDel, 1, false);
-		}
+		GetEliminated();
 	}
 	else 
 	{
-		ExpireInteractEffectDuration();
+		StartCooldown();
 	}
 }
+void AMPEnvActorComp::StartCooldown()
+{
+	WakeNetDormancy();
+	SetIsInCooldown(true);
 
-void AMPEnvActorComp::ExpireInteractEffectDuration()
+	UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(this);
+	if (!scheduler || totalCooldown <= 0)
+	{
+		EndCooldown();
+		return;
+	}
+
+	cooldownEndServerTime = scheduler->GetServerTime() + totalCooldown;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPEnvActorComp, cooldownEndServerTime, this);
+	scheduler->Cancel(cooldownEffectHandle);
+	cooldownEffectHandle = scheduler->Schedule(cooldownEndServerTime,
+		FSimpleDelegate::CreateUObject(this, &AMPEnvActorComp::EndCooldown));
+}
+void AMPEnvActorComp::EndCooldown()
 {
-	isInteracting = false;
-	interactedCharacter = nullptr;
+	SetIsInCooldown(false);
+	cooldownEffectHandle.Invalidate();
+	ReturnToNetDormancy();
+}
 
-	if (isSingleUse)
+float AMPEnvActorComp::GetInteractRemainingTime() const
+{
+	if (!isInteracting) return 0.0f;
+	return FMath::Max(interactEndServerTime - UMPEffectScheduler::GetServerTime(GetWorld()), 0.0f);
+}
+
+float AMPEnvActorComp::GetCooldownRemainingTime() const
+{
+	if (!isInCooldown) return 0.0f;
+	return FMath::Max(cooldownEndServerTime - UMPEffectScheduler::GetServerTime(GetWorld()), 0.0f);
+}
+
+void AMPEnvActorComp::SetIsInteracting(bool newInteracting)
+{
+	if (isInteracting == newInteracting) return;
+
+	isInteracting = newInteracting;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPEnvActorComp, isInteracting, this);
+	MarkInteractableDirty();
+}
+
+void AMPEnvActorComp::SetIsInCooldown(bool newInCooldown)
+{
+	if (isInCooldown == newInCooldown) return;
+
+	isInCooldown = newInCooldown;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMPEnvActorComp, isInCooldown, this);
+	MarkInteractableDirty();
+}
+
+AMPAISystemManager* AMPEnvActorComp::FindAISystemManager() const
+{
+	// LocateUrgentEnvActors fills theAIManager, env actors handed out by a pool later only find it through the registry
+	if (theAIManager) return theAIManager;
+	if (theAISystem) return theAISystem;
+
+	UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>();
+	return registry ? registry->GetAISystemManager() : nullptr;
+}
+
+// net dormancy
+void AMPEnvActorComp::WakeNetDormancy()
+{
+	if (!useNetDormancy || !HasAuthority()) return;
+
+	if (NetDormancy != DORM_Awake)
 	{
-		Destroy();
+		SetNetDormancy(DORM_Awake);
 	}
-	else 
+}
+
+void AMPEnvActorComp::ReturnToNetDormancy()
+{
+	if (!useNetDormancy || !HasAuthority()) return;
+	if (isInteracting || isInCooldown || !IsAtRest()) return;
+
+	// the channel still sends the last state change before it goes dormant
+	if (NetDormancy != DORM_DormantAll)
 	{
-		StartCooldown();
+		SetNetDormancy(DORM_DormantAll);
 	}
 }
-void AMPEnvActorComp::StartCooldown()
+
+// pooling
+void AMPEnvActorComp::GetEliminated()
 {
-	isInCooldown = true;
-	curCooldownCountDown = totalCooldown;
-	CooldownCountDown();
+	AMPGMGameplay* mpGameMode = Cast<AMPGMGameplay>(UGameplayStatics::GetGameMode(GetWorld()));
+	if (mpGameMode && mpGameMode->ReleaseEnvironment(this))
+	{
+		return;
+	}
+	Destroy();
 }
-void AMPEnvActorComp::CooldownCountDown()
+
+void AMPEnvActorComp::OnAcquiredFromPool()
 {
-	if (curCooldownCountDown > 0)
+	if (envActorBodyMesh)
 	{
-		UWorld* serverWorld = GetWorld();
-		if (serverWorld)
-		{	
-			curCooldownCountDown -= 1;
-
-			serverWorld->GetTimerManager().ClearTimer(cooldownTimerHandle);
-			FTimerDelegate cooldownTimerDel;
-			cooldownTimerDel.BindUFunction(this, FName("CooldownCountDown"));
-			serverWorld->GetTimerManager().SetTimer(cooldownTimerHandle, 
-				cooldownTimerDel, totalCooldown, false);
-		}
+		envActorBodyMesh->SetVisibility(true);
 	}
-	else 
+
+	// the factory moved it while it was dormant, send the new spot once
+	if (useNetDormancy && HasAuthority())
 	{
-		EndCooldown();
+		FlushNetDormancy();
+	}
+
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->RegisterEnvActor(this);
 	}
 }
-void AMPEnvActorComp::EndCooldown()
+
+void AMPEnvActorComp::OnReleasedToPool()
+{
+	// awake until parked, a dormant actor would never send the reset, the hide or the teleport
+	WakeNetDormancy();
+
+	if (UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(this))
+	{
+		scheduler->Cancel(interactEffectHandle);
+		scheduler->Cancel(cooldownEffectHandle);
+	}
+
+	SetIsInteracting(false);
+	SetIsInCooldown(false);
+	interactedCharacter = nullptr;
+
+	// an urgent event of a parked actor would send bots to the parking spot
+	if (AMPAISystemManager* aiSystem = HasAuthority() ? FindAISystemManager() : nullptr)
+	{
+		aiSystem->CancelUrgentEvent(this);
+	}
+
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->UnregisterEnvActor(this);
+	}
+}
+
+void AMPEnvActorComp::OnParkedInPool()
 {
-	isInCooldown = false;
+	// hidden and at the parking spot now, send that once and sleep until the next acquire
+	if (useNetDormancy && HasAuthority())
+	{
+		FlushNetDormancy();
+	}
+	ReturnToNetDormancy();
 }
 
 // =====================
@@ -211,24 +368,7 @@ void AMPEnvActorComp::PlaySoundLocally(USoundCue* aSound)
 
 void AMPEnvActorComp::PlaySoundBroadcast(USoundCue* aSound)
 {
-    if (HasAuthority())
-    {
-        PlaySoundMulticast(aSound);
-    }
-    else
-    {
-        PlaySoundServer(aSound);
-    }
-}
-
-void AMPEnvActorComp::PlaySoundServer_Implementation(USoundCue* aSound)
-{
-    PlaySoundMulticast(aSound);
-}
-
-void AMPEnvActorComp::PlaySoundMulticast_Implementation(USoundCue* aSound)
-{
-    PlaySoundLocally(aSound);
+    UMPSoundEventChannel::BroadcastSound(this, aSound, GetActorLocation());
 }
 
 // setter and getter
@@ -256,16 +396,23 @@ void AMPEnvActorComp::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(AMPEnvActorComp, isInteracting);
-    DOREPLIFETIME(AMPEnvActorComp, isInCooldown);
+    FDoRepLifetimeParams pushParams;
+    pushParams.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMPEnvActorComp, isInteracting, pushParams);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMPEnvActorComp, isInCooldown, pushParams);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMPEnvActorComp, interactEndServerTime, pushParams);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AMPEnvActorComp, cooldownEndServerTime, pushParams);
 }
 
 void AMPEnvActorComp::OnRep_Interacting()
 {
     // Placeholder for UI/FX sync when interaction state changes
+    MarkInteractableDirty();
 }
 
 void AMPEnvActorComp::OnRep_InCooldown()
 {
     // Placeholder for UI/FX sync when cooldown ends/starts
+    MarkInteractableDirty();
 }
\ No newline at end of file
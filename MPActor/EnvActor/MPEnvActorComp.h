@@ -26,14 +26,20 @@
 // - IMPInteractable / IMPPlaySoundInterface: Implements these interfaces to be discoverable by the character's interaction trace and to play sounds.
 // - AMPCharacter: Characters interact with it by calling `BeInteracted`. This class then controls the logic, timers, and cooldowns.
 // - AMPAISystemManager: If `isAbleToCauseUrgentEvent` is true, this actor can get a reference to the AI System Manager and send it notifications, causing AI to come and investigate.
-// - Replication: `isInteracting` and `isInCooldown` are replicated so all clients can correctly see the object's state (e.g., visually changing its material or disabling its interaction prompt).
+// - Replication: `isInteracting` and `isInCooldown` are replicated so all clients can correctly see the object's state (e.g., visually changing its material or disabling its interaction prompt). They are push-based and only change through `SetIsInteracting` / `SetIsInCooldown`.
+// - UMPEffectScheduler: Runs the interaction duration (with a pulse every second) and the cooldown. Only `interactEndServerTime` / `cooldownEndServerTime` are replicated; `GetInteractRemainingTime` / `GetCooldownRemainingTime` derive the countdown from them.
 // - Child Classes (`AMPEnvActorCompCage`, `...Fracture`, etc.): Inherit this base functionality and add more specialized logic (e.g., breaking, holding a cat).
+// - UFactoryEnvironment: Single-use actors leave the world through `GetEliminated`, which returns them to the environment factory pool when pooling is enabled instead of destroying them.
+// - UMPWorldRegistry: Registers itself on `BeginPlay` and unregisters on `EndPlay` or while parked in the pool, so match and AI setup iterate env actors without a level scan.
+// - Net dormancy: With `useNetDormancy` the actor starts `DORM_DormantAll`, so the server does not consider it for replication while nobody touches it. `BeInteracted` and `StartCooldown` wake it, and `EndCooldown` (or going back to the pool) puts it back to sleep once `IsAtRest` agrees. `UManagerMatch` samples how many env actors are dormant and logs the summary at the end of the match.
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "../MPInteractable.h"
 #include "../MPPlaySoundInterface.h"
+#include "../MPPoolable.h"
 #include "TimerManager.h"
+#include "../../HighLevel/MPEffectScheduler.h"
 
 #include "MPEnvActorComp.generated.h"
 
@@ -48,13 +54,16 @@ class UAudioComponent;
 class AMPAISystemManager;
 
 UCLASS(BlueprintType, Blueprintable)
-class AMPEnvActorComp : public AActor, public IMPInteractable, public IMPPlaySoundInterface
+class AMPEnvActorComp : public AActor, public IMPInteractable, public IMPPlaySoundInterface, public IMPPoolable
 {
     GENERATED_BODY()
 
 public:
     AMPEnvActorComp();
 
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type endPlayReason) override;
+
     // IMPPlaySoundInterface
     virtual void PlaySoundLocally(USoundCue* aSound) override;
     virtual void PlaySoundBroadcast(USoundCue* aSound) override;
@@ -66,13 +75,6 @@ public:
     UFUNCTION()
         void OnRep_InCooldown();
 
-protected:
-    UFUNCTION(Server, Reliable)
-        void PlaySoundServer(USoundCue* aSound);
-
-    UFUNCTION(NetMulticast, Reliable)
-        void PlaySoundMulticast(USoundCue* aSound);
-
     // common envActor properties
 protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Common Properties")
@@ -111,6 +113,9 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Urgent Properties")
     AMPAISystemManager* theAISystem = nullptr;
 
+    // theAIManager, theAISystem or the registry's manager, whichever is set
+    AMPAISystemManager* FindAISystemManager() const;
+
     // cat interaction
 protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Urgent Properties")
@@ -132,27 +137,43 @@ UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interface Properties")
     UFUNCTION(BlueprintCallable, Category = "Interface Method")
     virtual void BeInteracted(AMPCharacter* targetActor) override;
 
+    virtual uint32 GetInteractableVersion() const override { return interactableVersion; }
+    // children call this whenever the state their IsInteractable reads changes
+    void MarkInteractableDirty() { ++interactableVersion; }
+
 protected:
+    uint32 interactableVersion = 0;
+
+    // resolved once in BeginPlay, INDEX_NONE falls back to the key lookup
+    int32 interactHintTextHandle = INDEX_NONE;
+    int32 uninteractableHintTextHandle = INDEX_NONE;
+    void ResolveHintTextHandles();
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interface Properties")
     bool isSingleUse = false;
-    UPROPERTY(ReplicatedUsing = OnRep_Interacting, BlueprintReadWrite, Category = "Interface Properties")
+    UPROPERTY(ReplicatedUsing = OnRep_Interacting, BlueprintReadOnly, Category = "Interface Properties")
     bool isInteracting = false;
     UPROPERTY(BlueprintReadWrite, Category = "Interface Properties")
     AMPCharacter* interactedCharacter = nullptr;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interface Properties")
     float totalInteractDuration;
-    UPROPERTY(BlueprintReadWrite, Category = "Interface Properties")
-    float curInteractCountDown;
-    FTimerHandle interactTimerHandle;
+    // server time the interaction window ends, see UMPEffectScheduler
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Interface Properties")
+    float interactEndServerTime = 0.0f;
+    FMPEffectHandle interactEffectHandle;
 
     // cooldown
-    UPROPERTY(ReplicatedUsing = OnRep_InCooldown, BlueprintReadWrite, Category = "Interface Properties")
+    UPROPERTY(ReplicatedUsing = OnRep_InCooldown, BlueprintReadOnly, Category = "Interface Properties")
     bool isInCooldown;
+
+    // push model writers of isInteracting / isInCooldown
+    void SetIsInteracting(bool newInteracting);
+    void SetIsInCooldown(bool newInCooldown);
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interface Properties")
     float totalCooldown;
-    UPROPERTY(BlueprintReadWrite, Category = "Interface Properties")
-    float curCooldownCountDown;
-    FTimerHandle cooldownTimerHandle;
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Interface Properties")
+    float cooldownEndServerTime = 0.0f;
+    FMPEffectHandle cooldownEffectHandle;
 
     // interact specific
 protected:
@@ -163,12 +184,9 @@ protected:
 
     UFUNCTION(BlueprintCallable, Category = "Interface Method")
     void StartInteractEffectDuration(AMPCharacter* targetActor);
-    UFUNCTION(BlueprintCallable, Category = "Interface Method")
-    void ApplyInteractEffectDuration();
+    // applied once when the interaction starts and again every second until it expires
     UFUNCTION(BlueprintCallable, Category = "Interface Method")
     virtual void ApplyInteractEffectDurationEffect();
-    UFUNCTION(BlueprintCallable, Category = "Interface Method")
-    void ApplyInteractEffectDurationCountdown();
 
     UFUNCTION(BlueprintCallable, Category = "Interface Method")
     void ExpireInteractEffectDuration();
@@ -176,10 +194,41 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Interface Method")
     void StartCooldown();
     UFUNCTION(BlueprintCallable, Category = "Interface Method")
-    void CooldownCountDown();
-    UFUNCTION(BlueprintCallable, Category = "Interface Method")
     void EndCooldown();
 
+public:
+    // derived from the replicated end timestamps, valid on server and clients
+    UFUNCTION(BlueprintCallable, Category = "Interface Method")
+    float GetInteractRemainingTime() const;
+    UFUNCTION(BlueprintCallable, Category = "Interface Method")
+    float GetCooldownRemainingTime() const;
+
+    // net dormancy
+protected:
+    // dormant (nothing replicated) until something interacts with it
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication Properties")
+    bool useNetDormancy = true;
+
+    // server only, awake for the whole interaction / cooldown window
+    void WakeNetDormancy();
+    // server only, no-op while still interacting, cooling down or not at rest
+    void ReturnToNetDormancy();
+    // children with a moving body say so here, a dormant actor would stop replicating the movement
+    virtual bool IsAtRest() const { return true; }
+
+public:
+    bool IsNetDormant() const { return NetDormancy > DORM_Awake; }
+
+    // pooling
+public:
+    UFUNCTION(BlueprintCallable, Category = "Interface Method")
+    void GetEliminated();
+
+    // IMPPoolable
+    virtual void OnAcquiredFromPool() override;
+    virtual void OnReleasedToPool() override;
+    virtual void OnParkedInPool() override;
+
     // setter && getter
 public:
     UFUNCTION(BlueprintCallable, Category = "Setter && Getter")
@@ -3,6 +3,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "../../HighLevel/Managers/ManagerLog.h"
 #include "../../HighLevel/MPGS.h"
+#include "../../HighLevel/MPGMGameplay.h"
 #include "../Character/MPCharacter.h"
 #include "../Character/MPCharacterCat.h"
 #include "../Character/MPCharacterHuman.h"
@@ -111,6 +112,8 @@ void AMPEnvActorCompCage::CatchCat(AMPCharacter* humanActor, AMPCharacterCat* ca
                 // Player cat caught - update human progression
                 gameState->UpdateHumanProgression(1);
                 UManagerLog::LogInfo(TEXT("Player Cat Caught! Human Progression Updated"), TEXT("MPEnvActorCompCage"));
+
+                mpGameMode->CheckIfGameEnd();
             }
             else
             {
@@ -131,7 +134,7 @@ void AMPEnvActorCompCage::CatchCat(AMPCharacter* humanActor, AMPCharacterCat* ca
     // isOccupied = false;
     // isOccupiedReplicated = false;
 
-    UManagerLog::LogInfo(FString::Printf(TEXT("Cat caught in cage! IsPlayer: %s"), isPlayerCat ? TEXT("Yes") : TEXT("No")), TEXT("MPEnvActorCompCage"));
+    MP_LOG_INFO(TEXT("MPEnvActorCompCage"), TEXT("Cat caught in cage! IsPlayer: %s"), isPlayerCat ? TEXT("Yes") : TEXT("No"));
 }
 
 void AMPEnvActorCompCage::OnRep_IsOccupied()
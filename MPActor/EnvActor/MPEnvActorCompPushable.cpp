@@ -16,6 +16,7 @@ AMPEnvActorCompPushable::AMPEnvActorCompPushable()
 
     envActorBodyMesh->SetSimulatePhysics(false);
     envActorBodyMesh->SetNotifyRigidBodyCollision(true); // To receive OnHit
+    envActorBodyMesh->BodyInstance.bGenerateWakeEvents = true; // To receive OnBodySleep
 }
 
 void AMPEnvActorCompPushable::BeginPlay()
@@ -25,6 +26,7 @@ void AMPEnvActorCompPushable::BeginPlay()
     if (envActorBodyMesh)
     {
         envActorBodyMesh->OnComponentHit.AddDynamic(this, &AMPEnvActorCompPushable::OnHit);
+        envActorBodyMesh->OnComponentSleep.AddDynamic(this, &AMPEnvActorCompPushable::OnBodySleep);
     }
 }
 
@@ -38,7 +40,43 @@ void AMPEnvActorCompPushable::BeginDestroy()
 
 void AMPEnvActorCompPushable::BeRandomized()
 {
-    Destroy();
+    GetEliminated();
+}
+
+void AMPEnvActorCompPushable::OnAcquiredFromPool()
+{
+    hasContributedToProgression = false;
+
+    Super::OnAcquiredFromPool();
+}
+
+void AMPEnvActorCompPushable::OnReleasedToPool()
+{
+    // a pool release is not a destruction and awards nothing; while parked it counts as settled,
+    // so BeginDestroy at teardown does not award it either
+    isAlreadyPushed = false;
+    pushedCounter = 0;
+    hasContributedToProgression = true;
+
+    if (envActorBodyMesh && envActorBodyMesh->IsSimulatingPhysics())
+    {
+        envActorBodyMesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
+        envActorBodyMesh->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+        envActorBodyMesh->PutRigidBodyToSleep();
+    }
+
+    Super::OnReleasedToPool();
+}
+
+bool AMPEnvActorCompPushable::IsAtRest() const
+{
+    return !envActorBodyMesh || !envActorBodyMesh->IsSimulatingPhysics() || !envActorBodyMesh->RigidBodyIsAwake();
+}
+
+void AMPEnvActorCompPushable::OnBodySleep(UPrimitiveComponent* sleepingComponent, FName boneName)
+{
+    // the slide is over, sleep too unless the cooldown still runs (EndCooldown handles that)
+    ReturnToNetDormancy();
 }
 
 bool AMPEnvActorCompPushable::IsInteractable(AMPCharacter* targetActor)
@@ -76,21 +114,22 @@ void AMPEnvActorCompPushable::ApplyInteractEffectDirect(AMPCharacter* targetActo
 void AMPEnvActorCompPushable::OnHit(UPrimitiveComponent* HitComponent, AActor* OtherActor,
     UPrimitiveComponent* OtherComponent, FVector NormalImpulse, const FHitResult& Hit)
 {
-    UManagerLog::LogInfo(TEXT("Pushable EnvActor OnHIT called"), TEXT("MPEnvActorCompPushable"));
+    MP_LOG_VERBOSE(TEXT("MPEnvActorCompPushable"), TEXT("Pushable EnvActor OnHIT called"));
 
     float impactForce = NormalImpulse.Size();
 
     // Check if the hit actor is a character and stun them
     AMPCharacter* hitCharacter = Cast<AMPCharacter>(OtherActor);
-    if (hitCharacter && stunDuration > 0)
+    const bool stunnedCharacter = hitCharacter && stunDuration > 0;
+    if (stunnedCharacter)
     {
-        UManagerLog::LogInfo(TEXT("Character hit by pushable object - STUNNED!"), TEXT("MPEnvActorCompPushable"));
+        MP_LOG_INFO(TEXT("MPEnvActorCompPushable"), TEXT("Character hit by pushable object - STUNNED!"));
         hitCharacter->BeStunned(stunDuration); // This will call the appropriate override
     }
 
     if (isBreakable && impactForce >= breakableThreshold)
     {
-        UManagerLog::LogInfo(TEXT("Object broke due to impact!"), TEXT("MPEnvActorCompPushable"));
+        MP_LOG_INFO(TEXT("MPEnvActorCompPushable"), TEXT("Object broke due to impact!"));
 
         // Update progression before destroying the object
         UpdateCatTeamProgression();
@@ -104,7 +143,19 @@ void AMPEnvActorCompPushable::OnHit(UPrimitiveComponent* HitComponent, AActor* O
 			}
         }
 
-        Destroy();
+        GetEliminated();
+        return;
+    }
+
+    // something knocked the body while it slept, stay awake for the slide until OnBodySleep
+    if (!IsAtRest())
+    {
+        WakeNetDormancy();
+    }
+    else if (stunnedCharacter && useNetDormancy && HasAuthority())
+    {
+        // a one-off state change, send it without waking up
+        FlushNetDormancy();
     }
 }
 
@@ -128,8 +179,8 @@ void AMPEnvActorCompPushable::UpdateCatTeamProgression()
             // Mark as contributed to prevent double-counting (this will be replicated)
             hasContributedToProgression = true;
             
-            UManagerLog::LogInfo(FString::Printf(TEXT("Cat Team Progression Updated: +%f (Total: %f/%f)"), 
-                progressionWeight, gameState->curMPProgression, gameState->totalMPProgression), TEXT("MPEnvActorCompPushable"));
+            MP_LOG_INFO(TEXT("MPEnvActorCompPushable"), TEXT("Cat Team Progression Updated: +%f (Total: %f/%f)"), 
+                progressionWeight, gameState->curMPProgression, gameState->totalMPProgression);
             
             // Display current progression status (server only)
             mpGameMode->DisplayProgressionStatus();
@@ -26,6 +26,7 @@
 // - AMPCharacterCat: Cats are the intended interactors. When a cat interacts, `ApplyInteractEffectDirect` is called, which applies a physics impulse to the object.
 // - AMPEnvActorCompFracture: If the object is breakable, it spawns an instance of this class to replace itself upon destruction.
 // - OnHit event: It listens for physics collisions. If a collision is strong enough (`breakableThreshold`), it triggers the breaking logic.
+// - Net dormancy: The actor stays awake while its body is sliding, so clients get the whole movement. It returns to dormancy once the body sleeps and the cooldown is over.
 // - GameState (`AMPGS`): When pushed enough times or broken, it calls `UpdateCatTeamProgression` (likely via the Game Mode) to update the global game score.
 // - Replication: `isAlreadyPushed`, `pushedCounter`, and `hasContributedToProgression` are all replicated to keep clients in sync with the object's state.
 
@@ -59,6 +60,17 @@ protected:
     virtual void BeginDestroy() override;
     virtual void BeRandomized() override;
 
+public:
+    virtual void OnAcquiredFromPool() override;
+    virtual void OnReleasedToPool() override;
+
+protected:
+    // awake while the body simulates, it goes back to sleep from OnBodySleep
+    virtual bool IsAtRest() const override;
+
+    UFUNCTION()
+    void OnBodySleep(UPrimitiveComponent* sleepingComponent, FName boneName);
+
     // interactable interface
 public:
     virtual bool IsInteractable(AMPCharacter* targetActor) override;
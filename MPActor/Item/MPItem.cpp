@@ -9,10 +9,15 @@
 #include "Kismet/GameplayStatics.h"
 
 #include "../../CommonStruct.h"
+#include "../../HighLevel/MPGMGameplay.h"
+#include "../../HighLevel/MPWorldRegistry.h"
+#include "../../HighLevel/MPSoundEventChannel.h"
+#include "../../HighLevel/MPReplicationGraph.h"
 
 AMPItem::AMPItem()
 {
 	bReplicates = true;
+	NetDormancy = DORM_DormantAll;
 
 	USceneComponent* root = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
 	SetRootComponent(root);
@@ -33,6 +38,35 @@ AMPItem::AMPItem()
     itemAudioComp->SetupAttachment(RootComponent);
 }
 
+void AMPItem::BeginPlay()
+{
+	Super::BeginPlay();
+
+	ResolveHintTextHandles();
+
+	// Blueprint defaults are only in place from here on
+	NetCullDistanceSquared = FMath::Square(itemNetCullDistance);
+	if (!useNetDormancy && HasAuthority())
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->RegisterItem(this);
+	}
+}
+
+void AMPItem::EndPlay(const EEndPlayReason::Type endPlayReason)
+{
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->UnregisterItem(this);
+	}
+
+	Super::EndPlay(endPlayReason);
+}
+
 // interactable interface
 bool AMPItem::IsInteractable(AMPCharacter* player)
 {
@@ -43,11 +77,20 @@ FText AMPItem::GetInteractHintText(AMPCharacter* player)
 {
 	if (IsInteractable(player))
 	{
-		return UManagerLocalization::GetInstance()->GetLocalizedText(interactHintTextKey);
+		return UManagerLocalization::GetInstance()->GetLocalizedTextByHandleOrKey(interactHintTextHandle, interactHintTextKey);
 	}
 	else
 	{
-		return UManagerLocalization::GetInstance()->GetLocalizedText(uninteractableHintTextKey);
+		return UManagerLocalization::GetInstance()->GetLocalizedTextByHandleOrKey(uninteractableHintTextHandle, uninteractableHintTextKey);
+	}
+}
+
+void AMPItem::ResolveHintTextHandles()
+{
+	if (UManagerLocalization* localization = UManagerLocalization::GetInstance())
+	{
+		interactHintTextHandle = localization->FindTextHandle(FName(*interactHintTextKey));
+		uninteractableHintTextHandle = localization->FindTextHandle(FName(*uninteractableHintTextKey));
 	}
 }
 
@@ -69,6 +112,8 @@ void AMPItem::BePickedUp(AMPCharacter* player)
 {
 	isPickedUp = true;
 	itemOwner = player;
+	SetItemNetOwner(player);
+	MarkInteractableDirty();
 
 	if (itemBodyMesh)
     {
@@ -80,10 +125,18 @@ void AMPItem::BePickedUp(AMPCharacter* player)
     {
         itemCollision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     }
+
+	// a one-off change, sent once while the item stays dormant
+	if (useNetDormancy && HasAuthority())
+	{
+		FlushNetDormancy();
+	}
 }
 void AMPItem::BeDroped(AMPCharacter* player)
 {
 	isPickedUp = false;
+	SetItemNetOwner(nullptr);
+	MarkInteractableDirty();
 	
 	if (itemBodyMesh)
     {
@@ -95,6 +148,11 @@ void AMPItem::BeDroped(AMPCharacter* player)
     {
         itemCollision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
     }
+
+	if (useNetDormancy && HasAuthority())
+	{
+		FlushNetDormancy();
+	}
 }
 
 // usage
@@ -151,48 +209,36 @@ void AMPItem::EndUsageEffectDirect(AActor* targetActor)
 
 void AMPItem::StartUsageEffectDuration(AActor* targetActor)
 {
+	WakeNetDormancy();
 	isBeingUse = true;
 	targetActorSaved = targetActor;
-	curUsageCountDown = totalUsageDuration;
 
-	ApplyUsageEffectDuration();
-}
-
-void AMPItem::ApplyUsageEffectDuration()
-{
 	ApplyUsageEffectDurationEffect();
-	ApplyUsageEffectDurationCountdown();
+
+	UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(this);
+	if (!scheduler || totalUsageDuration <= 0)
+	{
+		ExpireUsageEffectDuration();
+		return;
+	}
+
+	usageEndServerTime = scheduler->GetServerTime() + totalUsageDuration;
+	scheduler->Cancel(usageEffectHandle);
+	usageEffectHandle = scheduler->Schedule(usageEndServerTime,
+		FSimpleDelegate::CreateUObject(this, &AMPItem::ExpireUsageEffectDuration),
+		1.0f, FSimpleDelegate::CreateUObject(this, &AMPItem::ApplyUsageEffectDurationEffect));
 }
+
 void AMPItem::ApplyUsageEffectDurationEffect()
 {
 	// effect ...
 }
-void AMPItem::ApplyUsageEffectDurationCountdown()
-{
-	if (curUsageCountDown > 0)
-	{
-		UWorld* serverWorld = GetWorld();
-		if (serverWorld)
-		{	
-			curUsageCountDown -= 1;
-
-			serverWorld->GetTimerManager().ClearTimer(usageTimerHandle);
-			FTimerDelegate usageTimerDel;
-			usageTimerDel.BindUFunction(this, FName("ApplyUsageEffectDuration"));
-			serverWorld->GetTimerManager().SetTimer(usageTimerHandle, 
-				usageTimerDel, 1, false);
-		}
-	}
-	else 
-	{
-		ExpireUsageEffectDuration();
-	}
-}
 
 void AMPItem::ExpireUsageEffectDuration()
 {
 	isBeingUse = false;
 	targetActorSaved = nullptr;
+	usageEffectHandle.Invalidate();
 
 	if (isSingleUse)
 	{
@@ -208,42 +254,146 @@ void AMPItem::ExpireUsageEffectDuration()
 }
 void AMPItem::StartCooldown()
 {
+	WakeNetDormancy();
 	isInCooldown = true;
-	curCooldownCountDown = totalCooldown;
-	CooldownCountDown();
+
+	UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(this);
+	if (!scheduler || totalCooldown <= 0)
+	{
+		EndCooldown();
+		return;
+	}
+
+	cooldownEndServerTime = scheduler->GetServerTime() + totalCooldown;
+	scheduler->Cancel(cooldownEffectHandle);
+	cooldownEffectHandle = scheduler->Schedule(cooldownEndServerTime,
+		FSimpleDelegate::CreateUObject(this, &AMPItem::EndCooldown));
+}
+void AMPItem::EndCooldown()
+{
+	isInCooldown = false;
+	cooldownEffectHandle.Invalidate();
+	ReturnToNetDormancy();
 }
-void AMPItem::CooldownCountDown()
+
+float AMPItem::GetUsageRemainingTime() const
+{
+	if (!isBeingUse) return 0.0f;
+	return FMath::Max(usageEndServerTime - UMPEffectScheduler::GetServerTime(GetWorld()), 0.0f);
+}
+
+float AMPItem::GetCooldownRemainingTime() const
+{
+	if (!isInCooldown) return 0.0f;
+	return FMath::Max(cooldownEndServerTime - UMPEffectScheduler::GetServerTime(GetWorld()), 0.0f);
+}
+
+// net dormancy / relevancy
+void AMPItem::SetItemNetOwner(AMPCharacter* newOwner)
 {
-	if (curCooldownCountDown > 0)
+	if (!HasAuthority() || GetOwner() == newOwner) return;
+
+	SetOwner(newOwner);
+	if (UMPReplicationGraph* replicationGraph = UMPReplicationGraph::Get(GetWorld()))
 	{
-		UWorld* serverWorld = GetWorld();
+		replicationGraph->NotifyNetOwnerChanged(this);
+	}
+}
 
-		if (serverWorld)
-		{	
-			curCooldownCountDown -=1;
-	
-			serverWorld->GetTimerManager().ClearTimer(cooldownTimerHandle);
-			FTimerDelegate usageCooldownTimerDel;
-			usageCooldownTimerDel.BindUFunction(this, FName("CooldownCountDown"));
-			serverWorld->GetTimerManager().SetTimer(cooldownTimerHandle,
-				usageCooldownTimerDel, totalCooldown, false);
-		}
+void AMPItem::WakeNetDormancy()
+{
+	if (!useNetDormancy || !HasAuthority()) return;
+
+	if (NetDormancy != DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
 	}
-	else 
+}
+
+void AMPItem::ReturnToNetDormancy()
+{
+	if (!useNetDormancy || !HasAuthority()) return;
+	if (isBeingUse || isInCooldown) return;
+
+	if (NetDormancy != DORM_DormantAll)
 	{
-		EndCooldown();
+		SetNetDormancy(DORM_DormantAll);
 	}
 }
-void AMPItem::EndCooldown()
+
+bool AMPItem::IsNetRelevantFor(const AActor* realViewer, const AActor* viewTarget, const FVector& srcLocation) const
 {
-	isInCooldown = false;
+	// the item stays where it was picked up, its owner's position is what matters
+	if (isPickedUp && itemOwner)
+	{
+		return itemOwner->IsNetRelevantFor(realViewer, viewTarget, srcLocation);
+	}
+	return Super::IsNetRelevantFor(realViewer, viewTarget, srcLocation);
 }
 
 void AMPItem::GetEliminated()
 {
+	AMPGMGameplay* mpGameMode = Cast<AMPGMGameplay>(UGameplayStatics::GetGameMode(GetWorld()));
+	if (mpGameMode && mpGameMode->ReleaseItem(this))
+	{
+		return;
+	}
 	Destroy();
 }
 
+void AMPItem::OnAcquiredFromPool()
+{
+	// back to the in-world look, BePickedUp hides it again when it goes straight into an inventory
+	OnRep_PickedUp();
+
+	// the factory moved it while it was dormant, send the new spot once
+	if (useNetDormancy && HasAuthority())
+	{
+		FlushNetDormancy();
+	}
+
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->RegisterItem(this);
+	}
+}
+
+void AMPItem::OnReleasedToPool()
+{
+	// awake until parked, a dormant actor would never send the reset, the hide or the teleport
+	WakeNetDormancy();
+
+	if (UMPEffectScheduler* scheduler = UMPEffectScheduler::Get(this))
+	{
+		scheduler->Cancel(usageEffectHandle);
+		scheduler->Cancel(cooldownEffectHandle);
+	}
+
+	isPickedUp = false;
+	isBeingUse = false;
+	isInCooldown = false;
+	itemOwner = nullptr;
+	SetItemNetOwner(nullptr);
+	targetActorSaved = nullptr;
+	usageEndServerTime = 0.0f;
+	cooldownEndServerTime = 0.0f;
+
+	if (UMPWorldRegistry* registry = GetWorld()->GetSubsystem<UMPWorldRegistry>())
+	{
+		registry->UnregisterItem(this);
+	}
+}
+
+void AMPItem::OnParkedInPool()
+{
+	// hidden and at the parking spot now, send that once and sleep until the next acquire
+	if (useNetDormancy && HasAuthority())
+	{
+		FlushNetDormancy();
+	}
+	ReturnToNetDormancy();
+}
+
 // =====================
 // PlaySound interface
 // =====================
@@ -266,24 +416,7 @@ void AMPItem::PlaySoundLocally(USoundCue* aSound)
 
 void AMPItem::PlaySoundBroadcast(USoundCue* aSound)
 {
-    if (HasAuthority())
-    {
-        PlaySoundMulticast(aSound);
-    }
-    else
-    {
-        PlaySoundServer(aSound);
-    }
-}
-
-void AMPItem::PlaySoundServer_Implementation(USoundCue* aSound)
-{
-    PlaySoundMulticast(aSound);
-}
-
-void AMPItem::PlaySoundMulticast_Implementation(USoundCue* aSound)
-{
-    PlaySoundLocally(aSound);
+    UMPSoundEventChannel::BroadcastSound(this, aSound, GetActorLocation());
 }
 
 void AMPItem::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -293,12 +426,16 @@ void AMPItem::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeP
     DOREPLIFETIME(AMPItem, isPickedUp);
     DOREPLIFETIME(AMPItem, isBeingUse);
     DOREPLIFETIME(AMPItem, isInCooldown);
+    DOREPLIFETIME(AMPItem, usageEndServerTime);
+    DOREPLIFETIME(AMPItem, cooldownEndServerTime);
 }
 
 // Replication callbacks
 
 void AMPItem::OnRep_PickedUp()
 {
+    MarkInteractableDirty();
+
     if (isPickedUp)
     {
         // Mirror BePickedUp visuals locally
@@ -27,15 +27,21 @@
 // How it interacts with other classes:
 // - AActor / IMPInteractable: It exists in the world as an actor that characters can interact with to pick it up.
 // - AMPCharacter: When picked up (`BePickedUp`), the item is "owned" by the character, its collision is disabled, and it is hidden. The character can then call `BeUsed` or `BeDroped`.
-// - UFactoryItem: Responsible for spawning these items in the world.
+// - UFactoryItem: Responsible for spawning these items in the world. `GetEliminated` hands the item back to the factory pool when pooling is enabled, and `OnReleasedToPool` resets it for the next owner.
+// - UMPWorldRegistry: Registers itself on `BeginPlay` (and when handed out by the pool) so match setup can find every item without a level scan.
 // - Replication: `isPickedUp`, `isBeingUse`, and `isInCooldown` are all replicated. This ensures clients have a correct representation of the item's state, whether it's in the world or in a player's inventory, and whether it's usable. `OnRep_` functions trigger the visual changes (like hiding the mesh when picked up).
+// - UMPEffectScheduler: Runs the usage duration (with a pulse every second) and the cooldown. Only `usageEndServerTime` / `cooldownEndServerTime` are replicated; `GetUsageRemainingTime` / `GetCooldownRemainingTime` derive the countdown from them.
+// - Net dormancy / relevancy: With `useNetDormancy` the item starts `DORM_DormantAll`. Picking up and dropping send the change once and sleep again, `StartUsageEffectDuration` and `StartCooldown` keep it awake until `EndCooldown`. A world item is culled beyond `itemNetCullDistance`; a picked up item is relevant wherever its owner is, so inventories never point at an item the client does not have.
+// - UMPReplicationGraph: A picked up item becomes the actor owner's (`SetItemNetOwner`) and moves from the spatial grid to its owner's connection node until it is dropped.
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "../MPInteractable.h"
 
 #include "TimerManager.h"
+#include "../../HighLevel/MPEffectScheduler.h"
 #include "../MPPlaySoundInterface.h"
+#include "../MPPoolable.h"
 #include "MPItem.generated.h"
 
 enum class EMPItem : uint8;
@@ -45,13 +51,16 @@ class UAudioComponent;
 enum class EItemType : uint8;
 
 UCLASS(BlueprintType, Blueprintable)
-class AMPItem : public AActor, public IMPInteractable, public IMPPlaySoundInterface
+class AMPItem : public AActor, public IMPInteractable, public IMPPlaySoundInterface, public IMPPoolable
 {
     GENERATED_BODY()
 
 public :
     AMPItem();
 
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type endPlayReason) override;
+
 // common item properties
 protected :
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Common Properties")
@@ -91,6 +100,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Interface Method")
         virtual void BeInteracted(AMPCharacter* player) override;
 
+        virtual uint32 GetInteractableVersion() const override { return interactableVersion; }
+        void MarkInteractableDirty() { ++interactableVersion; }
+
+protected :
+    uint32 interactableVersion = 0;
+
+    // resolved once in BeginPlay, INDEX_NONE falls back to the key lookup
+    int32 interactHintTextHandle = INDEX_NONE;
+    int32 uninteractableHintTextHandle = INDEX_NONE;
+    void ResolveHintTextHandles();
+
 // initialize / interact
 protected :
     UPROPERTY(BlueprintReadWrite, Category = "Cooldown Properties")
@@ -119,18 +139,19 @@ protected :
         AActor* targetActorSaved = nullptr;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Usage Properties")
         float totalUsageDuration;
-    UPROPERTY(BlueprintReadWrite, Category = "Cooldown Properties")
-        float curUsageCountDown;
-    FTimerHandle usageTimerHandle;
+    // server time the usage window ends, see UMPEffectScheduler
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Usage Properties")
+        float usageEndServerTime = 0.0f;
+    FMPEffectHandle usageEffectHandle;
 
     // cooldown
     UPROPERTY(ReplicatedUsing = OnRep_InCooldown, BlueprintReadWrite, Category = "Cooldown Properties")
         bool isInCooldown;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cooldown Properties")
         float totalCooldown;
-    UPROPERTY(BlueprintReadWrite, Category = "Cooldown Properties")
-        float curCooldownCountDown;
-    FTimerHandle cooldownTimerHandle;
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Cooldown Properties")
+        float cooldownEndServerTime = 0.0f;
+    FMPEffectHandle cooldownEffectHandle;
 
 public :
     /* no item is direct use, player select an item and then use it or drop it */
@@ -146,37 +167,59 @@ public :
 
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
         void StartUsageEffectDuration(AActor* targetActor);    
-    UFUNCTION(BlueprintCallable, Category = "Usage Method")
-        void ApplyUsageEffectDuration();
+    // applied once when the usage starts and again every second until it expires
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
         virtual void ApplyUsageEffectDurationEffect();
-    UFUNCTION(BlueprintCallable, Category = "Usage Method")
-        void ApplyUsageEffectDurationCountdown();
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
         void ExpireUsageEffectDuration();
 
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
         void StartCooldown();
-    UFUNCTION(BlueprintCallable, Category = "Usage Method")
-        void CooldownCountDown();
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
         void EndCooldown();
 
+    // derived from the replicated end timestamps, valid on server and clients
+    UFUNCTION(BlueprintCallable, Category = "Usage Method")
+        float GetUsageRemainingTime() const;
+    UFUNCTION(BlueprintCallable, Category = "Usage Method")
+        float GetCooldownRemainingTime() const;
+
+// net dormancy / relevancy
+protected :
+    // dormant (nothing replicated) while it lies in the world or sits unused in an inventory
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication Properties")
+        bool useNetDormancy = true;
+    // a world item is only relevant to viewers within this distance, a picked up item follows its owner
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication Properties")
+        float itemNetCullDistance = 5000.0f;
+
+    // server only, sets the actor owner and re-routes the item in the replication graph
+    void SetItemNetOwner(AMPCharacter* newOwner);
+
+    // server only, awake for the whole usage / cooldown window
+    void WakeNetDormancy();
+    // server only, no-op while still being used or cooling down
+    void ReturnToNetDormancy();
+
+public :
+    bool IsNetDormant() const { return NetDormancy > DORM_Awake; }
+
+    // used without the replication graph, the graph replicates a picked up item as a dependent of its owner instead
+    virtual bool IsNetRelevantFor(const AActor* realViewer, const AActor* viewTarget, const FVector& srcLocation) const override;
+
 public :
     UFUNCTION(BlueprintCallable, Category = "Usage Method")
         void GetEliminated();
 
+    // IMPPoolable
+    virtual void OnAcquiredFromPool() override;
+    virtual void OnReleasedToPool() override;
+    virtual void OnParkedInPool() override;
+
     // IMPPlaySoundInterface
     virtual void PlaySoundLocally(USoundCue* aSound) override;
     virtual void PlaySoundBroadcast(USoundCue* aSound) override;
 
-protected:
-    UFUNCTION(Server, Reliable)
-        void PlaySoundServer(USoundCue* aSound);
-
-    UFUNCTION(NetMulticast, Reliable)
-        void PlaySoundMulticast(USoundCue* aSound);
-
 public :
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
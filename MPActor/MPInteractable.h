@@ -13,6 +13,7 @@
 //
 // Necessary things to define:
 // - Any C++ class that should be interactable MUST publicly inherit from `IMPInteractable` and provide concrete implementations for all three virtual functions.
+// - Classes whose hint text can change (picked up, held, occupied...) should also override `GetInteractableVersion` and bump it whenever that state changes. The character only asks for the hint text again when the version changes.
 //
 // How it interacts with other classes:
 // - UInterface: The base class for Unreal Engine interfaces.
@@ -42,4 +43,7 @@ public:
     virtual FText GetInteractHintText(AMPCharacter* player) = 0;
 
     virtual void BeInteracted(AMPCharacter* player) = 0;
+
+    // bumped whenever IsInteractable / GetInteractHintText could return something different
+    virtual uint32 GetInteractableVersion() const { return 0; }
 };
\ No newline at end of file
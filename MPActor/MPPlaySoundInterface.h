@@ -12,12 +12,13 @@
 // Necessary things to define:
 // - Any C++ class that needs to play sounds using this system must implement both `PlaySoundLocally` and `PlaySoundBroadcast`.
 // - `PlaySoundLocally`: The implementation should just play the sound at the actor's location. This is for UI feedback or sounds that are only relevant to the person causing them.
-// - `PlaySoundBroadcast`: The implementation should typically be a Server RPC that then calls a NetMulticast RPC to play the sound on the server and all clients. This is for important gameplay sounds that everyone needs to hear (e.g., an item being used, an object breaking).
+// - `PlaySoundBroadcast`: The implementation should forward to `UMPSoundEventChannel::BroadcastSound` with the actor location, which batches the sound with the rest of the frame's sounds and sends it to every player in range. This is for important gameplay sounds that everyone needs to hear (e.g., an item being used, an object breaking). Do not add per-actor RPCs for sounds.
 //
 // How it interacts with other classes:
 // - UInterface: The base class.
 // - AMPCharacter, AMPItem, etc.: These classes implement the interface. For example, when an item is used, its `BeUsed` function might call `PlaySoundBroadcast` on itself to notify all players.
 // - USoundCue: The sound assets to be played are passed as `USoundCue` pointers.
+// - UMPSoundEventChannel: The shared broadcast path. A broadcast sound plays at the location it was triggered and does not follow the actor afterwards.
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
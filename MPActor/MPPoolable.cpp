@@ -0,0 +1 @@
+#include "MPPoolable.h"
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+// [Meow-Phone Project]
+//
+// This is a C++ only interface for actors that can be recycled by the factory actor pools
+// instead of being destroyed and spawned again. It defines the reset hook that every pooled
+// actor must provide, so an actor taken out of a pool behaves exactly like a freshly spawned one.
+//
+// How to utilize in Blueprint:
+// - This interface cannot be implemented in Blueprints. C++ classes must inherit from `IMPPoolable` to be pooled.
+// - Blueprint children of `AMPItem`, `AMPAbility` and `AMPEnvActorComp` are poolable automatically through their C++ parents.
+//
+// Necessary things to define:
+// - `OnReleasedToPool`: Clear every timer, replicated flag and owner reference the actor gathered during its life. The factory hides the actor and disables its collision and tick afterwards.
+// - `OnParkedInPool` (optional): Runs after the factory hid and moved the actor. A net dormant actor flushes the park here and goes back to sleep.
+// - `OnAcquiredFromPool`: Restore the "just spawned" state (visibility of sub components, default collision profiles, etc.). The factory has already moved, shown and re-enabled the actor.
+//
+// How it interacts with other classes:
+// - UMPFactory: Calls `OnReleasedToPool` then `OnParkedInPool` in `ReleaseMPActor` and `PrewarmPool`, and `OnAcquiredFromPool` when a spawn request is served from a pool.
+// - AMPItem, AMPAbility, AMPEnvActorComp: Implement this interface. Their `GetEliminated` functions hand them back to the Game Mode, which returns them to the owning factory pool.
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "MPPoolable.generated.h"
+
+UINTERFACE(MinimalAPI, Meta = (CannotImplementInterfaceInBlueprint))
+class UMPPoolable : public UInterface
+{
+    GENERATED_BODY()
+};
+
+class IMPPoolable
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnAcquiredFromPool() = 0;
+
+    virtual void OnReleasedToPool() = 0;
+
+    virtual void OnParkedInPool() {}
+};
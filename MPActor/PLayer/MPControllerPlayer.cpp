@@ -105,8 +105,8 @@ void AMPControllerPlayer::ClientTeamSwitchResult_Implementation(ETeam newTeam, b
 {
 	if (success)
 	{
-		UManagerLog::LogInfo(FString::Printf(TEXT("Successfully switched to %s team"), 
-			newTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat")), TEXT("MPControllerPlayer"));
+		MP_LOG_INFO(TEXT("MPControllerPlayer"), TEXT("Successfully switched to %s team"), 
+			newTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat"));
 		
 		// Update HUD team button visibility
 		if (ManagerLobbyHUD && ManagerLobbyHUD->lobbyHUD)
@@ -116,8 +116,8 @@ void AMPControllerPlayer::ClientTeamSwitchResult_Implementation(ETeam newTeam, b
 	}
 	else
 	{
-		UManagerLog::LogWarning(FString::Printf(TEXT("Failed to switch to %s team"), 
-			newTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat")), TEXT("MPControllerPlayer"));
+		MP_LOG_WARNING(TEXT("MPControllerPlayer"), TEXT("Failed to switch to %s team"), 
+			newTeam == ETeam::EHuman ? TEXT("Human") : TEXT("Cat"));
 	}
 }
 
@@ -945,8 +945,8 @@ void AMPControllerPlayer::ClientReadyStateResult_Implementation(bool inIsReady,
 {
 	if (success)
 	{
-		UManagerLog::LogInfo(FString::Printf(TEXT("Ready state updated successfully: %s"), 
-			inIsReady ? TEXT("Ready") : TEXT("Not Ready")), TEXT("MPControllerPlayer"));
+		MP_LOG_INFO(TEXT("MPControllerPlayer"), TEXT("Ready state updated successfully: %s"), 
+			inIsReady ? TEXT("Ready") : TEXT("Not Ready"));
 		
 		// Update HUD if available
 		if (ManagerLobbyHUD)
@@ -956,8 +956,8 @@ void AMPControllerPlayer::ClientReadyStateResult_Implementation(bool inIsReady,
 	}
 	else
 	{
-		UManagerLog::LogWarning(FString::Printf(TEXT("Failed to update ready state: %s"), 
-			inIsReady ? TEXT("Ready") : TEXT("Not Ready")), TEXT("MPControllerPlayer"));
+		MP_LOG_WARNING(TEXT("MPControllerPlayer"), TEXT("Failed to update ready state: %s"), 
+			inIsReady ? TEXT("Ready") : TEXT("Not Ready"));
 	}
 }
 
@@ -965,12 +965,12 @@ void AMPControllerPlayer::ClientAddBotResult_Implementation(ETeam team, bool suc
 {
 	if (success)
 	{
-		UManagerLog::LogInfo(FString::Printf(TEXT("Successfully added bot to team: %d"), (int32)team), TEXT("MPControllerPlayer"));
-		// HUD will be updated via GameMode's ClientUpdateLobbyHUDs RPC
+		MP_LOG_INFO(TEXT("MPControllerPlayer"), TEXT("Successfully added bot to team: %d"), (int32)team);
+		// HUD is patched by the lobby roster event from AMPGS
 	}
 	else
 	{
-		UManagerLog::LogWarning(FString::Printf(TEXT("Failed to add bot to team: %d"), (int32)team), TEXT("MPControllerPlayer"));
+		MP_LOG_WARNING(TEXT("MPControllerPlayer"), TEXT("Failed to add bot to team: %d"), (int32)team);
 	}
 }
 
@@ -978,12 +978,29 @@ void AMPControllerPlayer::ClientRemoveBotResult_Implementation(int32 playerIndex
 {
 	if (success)
 	{
-		UManagerLog::LogInfo(FString::Printf(TEXT("Successfully removed bot at index: %d"), playerIndex), TEXT("MPControllerPlayer"));
-		// HUD will be updated via GameMode's ClientUpdateLobbyHUDs RPC
+		MP_LOG_INFO(TEXT("MPControllerPlayer"), TEXT("Successfully removed bot at index: %d"), playerIndex);
+		// HUD is patched by the lobby roster event from AMPGS
 	}
 	else
 	{
-		UManagerLog::LogWarning(FString::Printf(TEXT("Failed to remove bot at index: %d"), playerIndex), TEXT("MPControllerPlayer"));
+		MP_LOG_WARNING(TEXT("MPControllerPlayer"), TEXT("Failed to remove bot at index: %d"), playerIndex);
+	}
+}
+
+// sound events
+void AMPControllerPlayer::ServerBroadcastSoundEvent_Implementation(USoundCue* sound, FVector_NetQuantize location)
+{
+	if (UMPSoundEventChannel* channel = GetWorld()->GetSubsystem<UMPSoundEventChannel>())
+	{
+		channel->QueueClientSoundEvent(sound, location, this);
+	}
+}
+
+void AMPControllerPlayer::ClientPlaySoundEvents_Implementation(const TArray<FMPSoundEvent>& soundEvents)
+{
+	if (UMPSoundEventChannel* channel = GetWorld()->GetSubsystem<UMPSoundEventChannel>())
+	{
+		channel->PlaySoundEvents(soundEvents);
 	}
 }
 
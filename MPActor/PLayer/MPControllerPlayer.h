@@ -30,10 +30,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "../../HighLevel/MPSoundEventChannel.h"
 #include "MPControllerPlayer.generated.h"
 
 enum class EHUDType : uint8;
 
+class USoundCue;
 class UHUDInit;
 class UHUDOption;
 class UHUDSessionGeneral;
@@ -118,6 +120,17 @@ public :
     UFUNCTION(Client, Reliable)
         void ClientRemoveBotResult(int32 playerIndex, bool success);
 
+// sound events
+
+public:
+    // a sound this client already played for itself, queued on the server channel for everyone else once the channel has checked cue, location and rate
+    UFUNCTION(Server, Unreliable)
+        void ServerBroadcastSoundEvent(USoundCue* sound, FVector_NetQuantize location);
+
+    // this frame's sound events in range of this player, see UMPSoundEventChannel
+    UFUNCTION(Client, Unreliable)
+        void ClientPlaySoundEvents(const TArray<FMPSoundEvent>& soundEvents);
+
 // hud manager
 
 protected :
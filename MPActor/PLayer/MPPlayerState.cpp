@@ -35,22 +35,22 @@ void AMPPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 
 void AMPPlayerState::OnRep_PlayerTeam()
 {
-	UManagerLog::LogDebug(FString::Printf(TEXT("Player %s team replicated: %d"), 
-		*playerName, (int32)playerTeam), TEXT("MPPlayerState"));
+	MP_LOG_DEBUG(TEXT("MPPlayerState"), TEXT("Player %s team replicated: %d"), 
+		*playerName, (int32)playerTeam);
 	
 	// Update HUD if this is the local player
 	AMPControllerPlayer* playerController = Cast<AMPControllerPlayer>(GetOwner());
 	if (playerController && playerController->IsLocalPlayerController() && playerController->GetManagerLobbyHUD() && playerController->GetManagerLobbyHUD()->lobbyHUD)
 	{
-		// Only update team button visibility, full list update will be handled by GameMode RPC
+		// Only update team button visibility, the list entry is moved by the lobby roster event from AMPGS
 		playerController->GetManagerLobbyHUD()->lobbyHUD->UpdateTeamButtonVisibility();
 	}
 }
 
 void AMPPlayerState::OnRep_IsPlayerReady()
 {
-	UManagerLog::LogDebug(FString::Printf(TEXT("Player %s ready state replicated: %s"), 
-		*playerName, isPlayerReady ? TEXT("Ready") : TEXT("Not Ready")), TEXT("MPPlayerState"));
+	MP_LOG_DEBUG(TEXT("MPPlayerState"), TEXT("Player %s ready state replicated: %s"), 
+		*playerName, isPlayerReady ? TEXT("Ready") : TEXT("Not Ready"));
 	
 	// Update HUD if this is the local player
 	AMPControllerPlayer* playerController = Cast<AMPControllerPlayer>(GetOwner());
@@ -63,6 +63,6 @@ void AMPPlayerState::OnRep_IsPlayerReady()
 
 void AMPPlayerState::OnRep_IsPlayerDied()
 {
-	UManagerLog::LogDebug(FString::Printf(TEXT("Player %s death state replicated: %s"), 
-		*playerName, isPlayerDied ? TEXT("Dead") : TEXT("Alive")), TEXT("MPPlayerState"));
+	MP_LOG_DEBUG(TEXT("MPPlayerState"), TEXT("Player %s death state replicated: %s"), 
+		*playerName, isPlayerDied ? TEXT("Dead") : TEXT("Alive"));
 }
\ No newline at end of file
@@ -245,20 +245,20 @@ void UHUDCreateSession::OnSessionNameChanged(const FText& newText)
         }
     }
     
-    UManagerLog::LogDebug(FString::Printf(TEXT("Session name changed to '%s'"), *sessionName), TEXT("HUDCreateSession"));
+    MP_LOG_DEBUG(TEXT("HUDCreateSession"), TEXT("Session name changed to '%s'"), *sessionName);
 }
 
 void UHUDCreateSession::OnHostNameChanged(const FText& newText)
 {
     hostName = newText.ToString();
-    UManagerLog::LogDebug(FString::Printf(TEXT("Host name changed to '%s'"), *hostName), TEXT("HUDCreateSession"));
+    MP_LOG_DEBUG(TEXT("HUDCreateSession"), TEXT("Host name changed to '%s'"), *hostName);
 }
 
 void UHUDCreateSession::OnPasswordCheckChanged(bool isChecked)
 {
     usePassword = isChecked;
     UpdatePasswordFieldVisibility();
-    UManagerLog::LogDebug(FString::Printf(TEXT("Password enabled: %s"), usePassword ? TEXT("Yes") : TEXT("No")), TEXT("HUDCreateSession"));
+    MP_LOG_DEBUG(TEXT("HUDCreateSession"), TEXT("Password enabled: %s"), usePassword ? TEXT("Yes") : TEXT("No"));
 }
 
 void UHUDCreateSession::OnPasswordChanged(const FText& newText)
@@ -350,13 +350,13 @@ void UHUDCreateSession::InitializeHostName()
         if (!steamUsername.IsEmpty())
         {
             hostName = steamUsername;
-            UManagerLog::LogDebug(FString::Printf(TEXT("Retrieved Steam username: %s"), *hostName), TEXT("HUDCreateSession"));
+            MP_LOG_DEBUG(TEXT("HUDCreateSession"), TEXT("Retrieved Steam username: %s"), *hostName);
         }
         else
         {
             // Fallback to random host name
             hostName = gameInstance->GenerateRandomName();
-            UManagerLog::LogDebug(FString::Printf(TEXT("Generated random host name: %s"), *hostName), TEXT("HUDCreateSession"));
+            MP_LOG_DEBUG(TEXT("HUDCreateSession"), TEXT("Generated random host name: %s"), *hostName);
         }
         
         // Set the hint text in the input field
@@ -404,9 +404,9 @@ void UHUDCreateSession::ValidateInputs()
         }
     }
     
-    UManagerLog::LogInfo(FString::Printf(TEXT("Validated inputs - Mode: %s, Session: '%s', Host: '%s', Password: %s"), 
+    MP_LOG_INFO(TEXT("HUDCreateSession"), TEXT("Validated inputs - Mode: %s, Session: '%s', Host: '%s', Password: %s"), 
            isMultiplayerMode ? TEXT("Multiplayer") : TEXT("Single Player"),
-           *sessionName, *hostName, usePassword ? TEXT("Yes") : TEXT("No")), TEXT("HUDCreateSession"));
+           *sessionName, *hostName, usePassword ? TEXT("Yes") : TEXT("No"));
 }
 
 // Session creation
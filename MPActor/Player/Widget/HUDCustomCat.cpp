@@ -118,8 +118,8 @@ void UHUDCustomCat::UpdateCustomizationOptions()
         abilityText->SetText(GetAbilityDisplayText(selectedAbility));
     }
     
-    UManagerLog::LogDebug(FString::Printf(TEXT("Updated customization options - Race: %d, Hat: %d, Ability: %d"), 
-        (int32)selectedCatRace, (int32)selectedHat, (int32)selectedAbility), TEXT("HUDCustomCat"));
+    MP_LOG_DEBUG(TEXT("HUDCustomCat"), TEXT("Updated customization options - Race: %d, Hat: %d, Ability: %d"), 
+        (int32)selectedCatRace, (int32)selectedHat, (int32)selectedAbility);
 }
 
 void UHUDCustomCat::UpdateCharacterPreview()
@@ -135,8 +135,8 @@ void UHUDCustomCat::UpdateCharacterPreview()
         }
         owner->FocusPreviewCamera();
     }
-    UManagerLog::LogDebug(FString::Printf(TEXT("Character preview updated - Race: %d, Hat: %d, Ability: %d"), 
-        (int32)selectedCatRace, (int32)selectedHat, (int32)selectedAbility), TEXT("HUDCustomCat"));
+    MP_LOG_DEBUG(TEXT("HUDCustomCat"), TEXT("Character preview updated - Race: %d, Hat: %d, Ability: %d"), 
+        (int32)selectedCatRace, (int32)selectedHat, (int32)selectedAbility);
 }
 
 void UHUDCustomCat::SaveCustomization()
@@ -150,8 +150,8 @@ void UHUDCustomCat::SaveCustomization()
             playerState->playerSelectedHat = selectedHat;
             playerState->playerSelectedAbility = selectedAbility;
             
-            UManagerLog::LogInfo(FString::Printf(TEXT("Customization saved - Race: %d, Hat: %d, Ability: %d"), 
-                (int32)selectedCatRace, (int32)selectedHat, (int32)selectedAbility), TEXT("HUDCustomCat"));
+            MP_LOG_INFO(TEXT("HUDCustomCat"), TEXT("Customization saved - Race: %d, Hat: %d, Ability: %d"), 
+                (int32)selectedCatRace, (int32)selectedHat, (int32)selectedAbility);
         }
         else
         {
@@ -175,8 +175,8 @@ void UHUDCustomCat::LoadCustomization()
             selectedHat = playerState->playerSelectedHat;
             selectedAbility = playerState->playerSelectedAbility;
             
-            UManagerLog::LogDebug(FString::Printf(TEXT("Customization loaded - Race: %d, Hat: %d, Ability: %d"), 
-                (int32)selectedCatRace, (int32)selectedHat, (int32)selectedAbility), TEXT("HUDCustomCat"));
+            MP_LOG_DEBUG(TEXT("HUDCustomCat"), TEXT("Customization loaded - Race: %d, Hat: %d, Ability: %d"), 
+                (int32)selectedCatRace, (int32)selectedHat, (int32)selectedAbility);
         }
         else
         {
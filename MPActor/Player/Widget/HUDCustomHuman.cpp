@@ -118,8 +118,8 @@ void UHUDCustomHuman::UpdateCustomizationOptions()
         abilityText->SetText(GetAbilityDisplayText(selectedAbility));
     }
     
-    UManagerLog::LogDebug(FString::Printf(TEXT("Updated customization options - Profession: %d, Hat: %d, Ability: %d"), 
-        (int32)selectedHumanProfession, (int32)selectedHat, (int32)selectedAbility), TEXT("HUDCustomHuman"));
+    MP_LOG_DEBUG(TEXT("HUDCustomHuman"), TEXT("Updated customization options - Profession: %d, Hat: %d, Ability: %d"), 
+        (int32)selectedHumanProfession, (int32)selectedHat, (int32)selectedAbility);
 }
 
 void UHUDCustomHuman::UpdateCharacterPreview()
@@ -135,8 +135,8 @@ void UHUDCustomHuman::UpdateCharacterPreview()
         }
         owner->FocusPreviewCamera();
     }
-    UManagerLog::LogDebug(FString::Printf(TEXT("Character preview updated - Profession: %d, Hat: %d, Ability: %d"), 
-        (int32)selectedHumanProfession, (int32)selectedHat, (int32)selectedAbility), TEXT("HUDCustomHuman"));
+    MP_LOG_DEBUG(TEXT("HUDCustomHuman"), TEXT("Character preview updated - Profession: %d, Hat: %d, Ability: %d"), 
+        (int32)selectedHumanProfession, (int32)selectedHat, (int32)selectedAbility);
 }
 
 void UHUDCustomHuman::SaveCustomization()
@@ -150,8 +150,8 @@ void UHUDCustomHuman::SaveCustomization()
             playerState->playerSelectedHat = selectedHat;
             playerState->playerSelectedAbility = selectedAbility;
             
-            UManagerLog::LogInfo(FString::Printf(TEXT("Customization saved - Profession: %d, Hat: %d, Ability: %d"), 
-                (int32)selectedHumanProfession, (int32)selectedHat, (int32)selectedAbility), TEXT("HUDCustomHuman"));
+            MP_LOG_INFO(TEXT("HUDCustomHuman"), TEXT("Customization saved - Profession: %d, Hat: %d, Ability: %d"), 
+                (int32)selectedHumanProfession, (int32)selectedHat, (int32)selectedAbility);
         }
         else
         {
@@ -175,8 +175,8 @@ void UHUDCustomHuman::LoadCustomization()
             selectedHat = playerState->playerSelectedHat;
             selectedAbility = playerState->playerSelectedAbility;
             
-            UManagerLog::LogDebug(FString::Printf(TEXT("Customization loaded - Profession: %d, Hat: %d, Ability: %d"), 
-                (int32)selectedHumanProfession, (int32)selectedHat, (int32)selectedAbility), TEXT("HUDCustomHuman"));
+            MP_LOG_DEBUG(TEXT("HUDCustomHuman"), TEXT("Customization loaded - Profession: %d, Hat: %d, Ability: %d"), 
+                (int32)selectedHumanProfession, (int32)selectedHat, (int32)selectedAbility);
         }
         else
         {
@@ -5,10 +5,9 @@
 #include "../MPControllerPlayer.h"
 #include "../MPPlayerState.h"
 #include "../../AI/MPAIController.h"
-#include "../../../HighLevel/MPGMGameplay.h"
+#include "../../../HighLevel/MPGS.h"
 #include "../../../HighLevel/MPGI.h"
 #include "../../../HighLevel/Managers/ManagerLog.h"
-#include "../../../HighLevel/Managers/ManagerAIController.h"
 #include "HUDLobbyEntry.h"
 
 UHUDLobby::UHUDLobby()
@@ -48,6 +47,12 @@ void UHUDLobby::NativeConstruct()
 	UpdateUI();
 	UpdatePlayerLists();
 	
+	// From here on the lists are patched one roster event at a time
+	if (AMPGS* gameState = GetWorld()->GetGameState<AMPGS>())
+	{
+		gameState->OnLobbyEvent.AddUObject(this, &UHUDLobby::HandleLobbyEvent);
+	}
+	
 	UManagerLog::LogInfo(TEXT("Lobby HUD constructed and initialized"), TEXT("HUDLobby"));
 }
 
@@ -74,8 +79,14 @@ void UHUDLobby::NativeDestruct()
 		catAddButton->OnClicked.RemoveAll(this);
 	}
 
+	if (AMPGS* gameState = GetWorld()->GetGameState<AMPGS>())
+	{
+		gameState->OnLobbyEvent.RemoveAll(this);
+	}
+	
 	// Clear player lists
 	ClearPlayerLists();
+	lobbyEntryPool.Empty();
 
 	Super::NativeDestruct();
 	
@@ -86,160 +97,245 @@ void UHUDLobby::UpdatePlayerLists()
 {
 	UManagerLog::LogDebug(TEXT("Updating player lists"), TEXT("HUDLobby"));
 	
-	// Clear existing lists
-	ClearPlayerLists();
-	
-	// Get GameMode to fetch player data
-	AMPGMGameplay* gameMode = Cast<AMPGMGameplay>(GetWorld()->GetAuthGameMode());
-	if (!gameMode)
+	// The replicated lobby roster is the same on the host and on clients
+	AMPGS* gameState = GetWorld()->GetGameState<AMPGS>();
+	if (!gameState)
 	{
-		UManagerLog::LogError(TEXT("Could not get GameMode for player list update"), TEXT("HUDLobby"));
+		UManagerLog::LogError(TEXT("Could not get GameState for player list update"), TEXT("HUDLobby"));
 		return;
 	}
 	
-	// Get human players
-	TArray<AMPControllerPlayer*> humanPlayers = gameMode->GetHumanPlayers();
-	for (AMPControllerPlayer* player : humanPlayers)
+	TArray<const FMPLobbyEntry*> humanRows;
+	TArray<const FMPLobbyEntry*> catRows;
+	for (const FMPLobbyEntry& rosterEntry : gameState->lobbyRoster.entries)
 	{
-		if (player)
+		if (rosterEntry.team == ETeam::EHuman)
 		{
-			AMPPlayerState* playerState = Cast<AMPPlayerState>(player->PlayerState);
-			if (playerState)
-			{
-				UHUDLobbyEntry* entry = CreateLobbyEntry(
-					playerState->playerName,
-					false, // Not a bot
-					playerState->isPlayerReady,
-					ETeam::EHuman,
-					playerState->playerIndex,
-					player,
-					nullptr // No AI controller for human players
-				);
-				
-				if (entry)
-				{
-					humanPlayersList.Add(entry);
-					if (humanPlayersScrollBox)
-					{
-						humanPlayersScrollBox->AddChild(entry);
-					}
-				}
-			}
+			humanRows.Add(&rosterEntry);
 		}
+		else if (rosterEntry.team == ETeam::ECat)
+		{
+			catRows.Add(&rosterEntry);
+		}
+	}
+	
+	// A client's roster is not in the server's order, the lists are sorted the same way everywhere
+	auto sortRows = [](const FMPLobbyEntry& a, const FMPLobbyEntry& b) { return IsListedBefore(a.isBot, a.lobbyId, b.isBot, b.lobbyId); };
+	humanRows.Sort(sortRows);
+	catRows.Sort(sortRows);
+	
+	// Every entry shown now is up for reuse, whatever is left afterwards goes back to the pool
+	TMap<int32, UHUDLobbyEntry*> unusedEntries;
+	unusedEntries.Reserve(humanPlayersList.Num() + catPlayersList.Num());
+	for (UHUDLobbyEntry* entry : humanPlayersList)
+	{
+		if (entry) unusedEntries.Add(entry->lobbyId, entry);
 	}
+	for (UHUDLobbyEntry* entry : catPlayersList)
+	{
+		if (entry) unusedEntries.Add(entry->lobbyId, entry);
+	}
+	
+	int32 updatedEntries = 0;
+	SyncTeamList(humanRows, humanPlayersList, humanPlayersScrollBox, unusedEntries, updatedEntries);
+	SyncTeamList(catRows, catPlayersList, catPlayersScrollBox, unusedEntries, updatedEntries);
 	
-	// Get cat players
-	TArray<AMPControllerPlayer*> catPlayers = gameMode->GetCatPlayers();
-	for (AMPControllerPlayer* player : catPlayers)
+	for (const TPair<int32, UHUDLobbyEntry*>& unusedEntry : unusedEntries)
 	{
-		if (player)
-		{
-			AMPPlayerState* playerState = Cast<AMPPlayerState>(player->PlayerState);
-			if (playerState)
-			{
-				UHUDLobbyEntry* entry = CreateLobbyEntry(
-					playerState->playerName,
-					false, // Not a bot
-					playerState->isPlayerReady,
-					ETeam::ECat,
-					playerState->playerIndex,
-					player,
-					nullptr // No AI controller for human players
-				);
-				
-				if (entry)
-				{
-					catPlayersList.Add(entry);
-					if (catPlayersScrollBox)
-					{
-						catPlayersScrollBox->AddChild(entry);
-					}
-				}
-			}
-		}
+		ReleaseLobbyEntry(unusedEntry.Value);
 	}
 	
-	// Get human AI bots
-	TArray<AMPAIController*> humanAIs = gameMode->GetManagerAIController()->GetAllAIHumans();
-	for (int32 i = 0; i < humanAIs.Num(); i++)
+	MP_LOG_DEBUG(TEXT("HUDLobby"), TEXT("Updated player lists - Humans: %d, Cats: %d, Changed entries: %d, Removed entries: %d"), 
+		humanPlayersList.Num(), catPlayersList.Num(), updatedEntries, unusedEntries.Num());
+}
+
+void UHUDLobby::SyncTeamList(const TArray<const FMPLobbyEntry*>& rows, TArray<UHUDLobbyEntry*>& teamList, UScrollBox* scrollBox, 
+	TMap<int32, UHUDLobbyEntry*>& unusedEntries, int32& outUpdatedEntries)
+{
+	TArray<UHUDLobbyEntry*> newList;
+	newList.Reserve(rows.Num());
+	
+	for (const FMPLobbyEntry* row : rows)
 	{
-		AMPAIController* aiController = humanAIs[i];
-		if (aiController)
+		UHUDLobbyEntry* entry = nullptr;
+		if (unusedEntries.RemoveAndCopyValue(row->lobbyId, entry) && entry)
 		{
-			FString botName = FString::Printf(TEXT("Human Bot %d"), i + 1);
-			UHUDLobbyEntry* entry = CreateLobbyEntry(
-				botName,
-				true, // Is a bot
-				false, // Bots are always ready
-				ETeam::EHuman,
-				i, // Index in bot list
-				nullptr, // No player controller for bots
-				aiController
-			);
-			
-			if (entry)
+			// Same player or bot as before, only what changed is pushed to the widget
+			if (ApplyRosterEntry(entry, *row))
 			{
-				humanPlayersList.Add(entry);
-				if (humanPlayersScrollBox)
-				{
-					humanPlayersScrollBox->AddChild(entry);
-				}
+				outUpdatedEntries++;
 			}
 		}
+		else
+		{
+			entry = CreateRosterEntry(*row);
+			outUpdatedEntries++;
+		}
+		
+		if (entry)
+		{
+			newList.Add(entry);
+		}
 	}
 	
-	// Get cat AI bots
-	TArray<AMPAIController*> catAIs = gameMode->GetManagerAIController()->GetAllAICats();
-	for (int32 i = 0; i < catAIs.Num(); i++)
+	// The scroll box is only refilled when someone joined, left, switched team or moved; AddChild takes an entry from the other team's box
+	if (newList != teamList && scrollBox)
 	{
-		AMPAIController* aiController = catAIs[i];
-		if (aiController)
+		scrollBox->ClearChildren();
+		for (UHUDLobbyEntry* entry : newList)
 		{
-			FString botName = FString::Printf(TEXT("Cat Bot %d"), i + 1);
-			UHUDLobbyEntry* entry = CreateLobbyEntry(
-				botName,
-				true, // Is a bot
-				false, // Bots are always ready
-				ETeam::ECat,
-				humanAIs.Num() + i, // Index in combined bot list
-				nullptr, // No player controller for bots
-				aiController
-			);
-			
-			if (entry)
-			{
-				catPlayersList.Add(entry);
-				if (catPlayersScrollBox)
-				{
-					catPlayersScrollBox->AddChild(entry);
-				}
-			}
+			scrollBox->AddChild(entry);
 		}
 	}
 	
-	UManagerLog::LogDebug(FString::Printf(TEXT("Updated player lists - Humans: %d, Cats: %d"), 
-		humanPlayersList.Num(), catPlayersList.Num()), TEXT("HUDLobby"));
+	teamList = MoveTemp(newList);
 }
 
-void UHUDLobby::ClearPlayerLists()
+void UHUDLobby::HandleLobbyEvent(ELobbyEvent lobbyEvent, const FMPLobbyEntry& rosterEntry)
 {
-	// Clear human players
-	for (UHUDLobbyEntry* entry : humanPlayersList)
+	UHUDLobbyEntry* entry = FindLobbyEntry(rosterEntry.lobbyId);
+	
+	if (lobbyEvent == ELobbyEvent::EPlayerLeft || lobbyEvent == ELobbyEvent::EBotRemoved)
 	{
 		if (entry)
 		{
-			entry->RemoveFromParent();
+			RemoveFromTeamList(entry);
+			ReleaseLobbyEntry(entry);
 		}
+		return;
 	}
-	humanPlayersList.Empty();
 	
-	// Clear cat players
-	for (UHUDLobbyEntry* entry : catPlayersList)
+	// An entry missed while this widget was not constructed yet is added whatever the event
+	if (!entry)
 	{
+		entry = CreateRosterEntry(rosterEntry);
 		if (entry)
 		{
-			entry->RemoveFromParent();
+			InsertIntoTeamList(entry);
 		}
+		return;
+	}
+	
+	const bool hasSwitchedTeam = entry->playerTeam != rosterEntry.team;
+	ApplyRosterEntry(entry, rosterEntry);
+	
+	// Only a team switch moves the entry, everything else is updated where it is
+	if (hasSwitchedTeam)
+	{
+		RemoveFromTeamList(entry);
+		InsertIntoTeamList(entry);
+	}
+	
+	MP_LOG_DEBUG(TEXT("HUDLobby"), TEXT("Lobby event %d patched entry: %s"), (int32)lobbyEvent, *rosterEntry.playerName);
+}
+
+bool UHUDLobby::ApplyRosterEntry(UHUDLobbyEntry* entry, const FMPLobbyEntry& rosterEntry)
+{
+	// Other players' controllers do not exist on clients, so these are only set on the host
+	AMPControllerPlayer* playerController = rosterEntry.playerState ? Cast<AMPControllerPlayer>(rosterEntry.playerState->GetOwner()) : nullptr;
+	return entry->ApplyEntryData(rosterEntry.playerName, rosterEntry.isBot, rosterEntry.isReady, rosterEntry.team, 
+		rosterEntry.playerIndex, playerController, rosterEntry.botController);
+}
+
+UHUDLobbyEntry* UHUDLobby::CreateRosterEntry(const FMPLobbyEntry& rosterEntry)
+{
+	AMPControllerPlayer* playerController = rosterEntry.playerState ? Cast<AMPControllerPlayer>(rosterEntry.playerState->GetOwner()) : nullptr;
+	UHUDLobbyEntry* entry = CreateLobbyEntry(rosterEntry.playerName, rosterEntry.isBot, rosterEntry.isReady, rosterEntry.team, 
+		rosterEntry.playerIndex, playerController, rosterEntry.botController);
+	if (entry)
+	{
+		entry->lobbyId = rosterEntry.lobbyId;
+	}
+	return entry;
+}
+
+UHUDLobbyEntry* UHUDLobby::FindLobbyEntry(int32 lobbyId) const
+{
+	for (UHUDLobbyEntry* entry : humanPlayersList)
+	{
+		if (entry && entry->lobbyId == lobbyId) return entry;
+	}
+	for (UHUDLobbyEntry* entry : catPlayersList)
+	{
+		if (entry && entry->lobbyId == lobbyId) return entry;
+	}
+	return nullptr;
+}
+
+bool UHUDLobby::GetTeamList(ETeam team, TArray<UHUDLobbyEntry*>*& outTeamList, UScrollBox*& outScrollBox)
+{
+	switch (team)
+	{
+	case ETeam::EHuman:
+		outTeamList = &humanPlayersList;
+		outScrollBox = humanPlayersScrollBox;
+		return true;
+	case ETeam::ECat:
+		outTeamList = &catPlayersList;
+		outScrollBox = catPlayersScrollBox;
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool UHUDLobby::IsListedBefore(bool isBotA, int32 lobbyIdA, bool isBotB, int32 lobbyIdB)
+{
+	return isBotA != isBotB ? !isBotA : lobbyIdA < lobbyIdB;
+}
+
+void UHUDLobby::InsertIntoTeamList(UHUDLobbyEntry* entry)
+{
+	TArray<UHUDLobbyEntry*>* teamList = nullptr;
+	UScrollBox* scrollBox = nullptr;
+	if (!GetTeamList(entry->playerTeam, teamList, scrollBox))
+	{
+		// A player without a team is not listed
+		ReleaseLobbyEntry(entry);
+		return;
+	}
+	
+	int32 insertIndex = 0;
+	while (insertIndex < teamList->Num() && IsListedBefore((*teamList)[insertIndex]->isBot, (*teamList)[insertIndex]->lobbyId, entry->isBot, entry->lobbyId))
+	{
+		insertIndex++;
+	}
+	
+	teamList->Insert(entry, insertIndex);
+	if (scrollBox)
+	{
+		scrollBox->InsertChildAt(insertIndex, entry);
+	}
+}
+
+void UHUDLobby::RemoveFromTeamList(UHUDLobbyEntry* entry)
+{
+	humanPlayersList.Remove(entry);
+	catPlayersList.Remove(entry);
+	entry->RemoveFromParent();
+}
+
+void UHUDLobby::ReleaseLobbyEntry(UHUDLobbyEntry* entry)
+{
+	if (!entry) return;
+	
+	entry->RemoveFromParent();
+	entry->lobbyId = INDEX_NONE;
+	lobbyEntryPool.Add(entry);
+}
+
+void UHUDLobby::ClearPlayerLists()
+{
+	// Entries go back to the pool, the next update reuses them
+	for (UHUDLobbyEntry* entry : humanPlayersList)
+	{
+		ReleaseLobbyEntry(entry);
+	}
+	humanPlayersList.Empty();
+	
+	for (UHUDLobbyEntry* entry : catPlayersList)
+	{
+		ReleaseLobbyEntry(entry);
 	}
 	catPlayersList.Empty();
 	
@@ -259,8 +355,8 @@ void UHUDLobby::UpdateReadyState(bool inIsReady)
 {
 	isReady = inIsReady;
 	
-	UManagerLog::LogDebug(FString::Printf(TEXT("Ready state updated: %s"), 
-		isReady ? TEXT("Ready") : TEXT("Not Ready")), TEXT("HUDLobby"));
+	MP_LOG_DEBUG(TEXT("HUDLobby"), TEXT("Ready state updated: %s"), 
+		isReady ? TEXT("Ready") : TEXT("Not Ready"));
 }
 
 void UHUDLobby::UpdateHostVisibility()
@@ -295,8 +391,8 @@ void UHUDLobby::UpdateHostVisibility()
 		}
 	}
 	
-	UManagerLog::LogDebug(FString::Printf(TEXT("Host visibility updated: %s"), 
-		isHost ? TEXT("Host") : TEXT("Client")), TEXT("HUDLobby"));
+	MP_LOG_DEBUG(TEXT("HUDLobby"), TEXT("Host visibility updated: %s"), 
+		isHost ? TEXT("Host") : TEXT("Client"));
 }
 
 void UHUDLobby::UpdateTeamButtonVisibility()
@@ -316,8 +412,8 @@ void UHUDLobby::UpdateTeamButtonVisibility()
 		catJoinButton->SetVisibility(showCatJoin ? ESlateVisibility::Visible : ESlateVisibility::Hidden);
 	}
 	
-	UManagerLog::LogDebug(FString::Printf(TEXT("Team button visibility updated: Current Team: %d"), 
-		(int32)currentTeam), TEXT("HUDLobby"));
+	MP_LOG_DEBUG(TEXT("HUDLobby"), TEXT("Team button visibility updated: Current Team: %d"), 
+		(int32)currentTeam);
 }
 
 void UHUDLobby::UpdateCountdownText(int32 secondsRemaining)
@@ -395,7 +491,7 @@ void UHUDLobby::OnCatAddButtonClicked()
 
 void UHUDLobby::OnRemoveBotClicked(int32 playerIndex)
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Remove bot clicked for index: %d"), playerIndex), TEXT("HUDLobby"));
+	MP_LOG_INFO(TEXT("HUDLobby"), TEXT("Remove bot clicked for index: %d"), playerIndex);
 	
 	if (owner && isHost)
 	{
@@ -422,25 +518,34 @@ UHUDLobbyEntry* UHUDLobby::CreateLobbyEntry(const FString& playerName, bool isBo
 		return nullptr;
 	}
 	
-	// Create the entry widget
-	UHUDLobbyEntry* entry = CreateWidget<UHUDLobbyEntry>(this, lobbyEntryClass);
+	// Take a pooled entry first, a new widget is only created when the pool is empty
+	UHUDLobbyEntry* entry = nullptr;
+	while (!entry && lobbyEntryPool.Num() > 0)
+	{
+		entry = lobbyEntryPool.Pop(false);
+	}
+	
 	if (!entry)
 	{
-		UManagerLog::LogError(TEXT("Failed to create lobby entry widget"), TEXT("HUDLobby"));
-		return nullptr;
+		entry = CreateWidget<UHUDLobbyEntry>(this, lobbyEntryClass);
+		if (!entry)
+		{
+			UManagerLog::LogError(TEXT("Failed to create lobby entry widget"), TEXT("HUDLobby"));
+			return nullptr;
+		}
+		
+		// Bind remove bot event, a pooled entry keeps its binding
+		entry->OnRemoveBotClicked.AddDynamic(this, &UHUDLobby::OnRemoveBotClicked);
 	}
 	
 	// Initialize the entry
 	entry->InitializeEntry(playerName, isBot, isEntryReady, team, playerIndex, playerController, aiController);
 	
-	// Bind remove bot event
-	entry->OnRemoveBotClicked.AddDynamic(this, &UHUDLobby::OnRemoveBotClicked);
-	
 	// Update host visibility
 	entry->UpdateHostVisibility(isHost);
 	
-	UManagerLog::LogDebug(FString::Printf(TEXT("Created lobby entry: %s (Bot: %s, Team: %d)"), 
-		*playerName, isBot ? TEXT("Yes") : TEXT("No"), (int32)team), TEXT("HUDLobby"));
+	MP_LOG_DEBUG(TEXT("HUDLobby"), TEXT("Set up lobby entry: %s (Bot: %s, Team: %d)"), 
+		*playerName, isBot ? TEXT("Yes") : TEXT("No"), (int32)team);
 	
 	return entry;
 }
@@ -10,7 +10,7 @@
 // 1. Create a Widget Blueprint inheriting from this class (e.g., `WBP_Lobby`).
 // 2. In the UMG editor, you must create all the UI elements and name them to match the `BindWidget` properties (e.g., `UScrollBox` named `humanPlayersScrollBox`, `UButton` named `humanJoinButton`).
 // 3. In the Blueprint's defaults, you MUST set the `Lobby Entry Class` property. This requires you to first create another Widget Blueprint for a single player row (inheriting from `UHUDLobbyEntry`) and then assign that `WBP_LobbyEntry` class here.
-// 4. This widget is managed by the `UHUDLobbyManager`. The manager is responsible for creating this widget and calling its `UpdatePlayerLists` function whenever the lobby state changes.
+// 4. This widget is managed by the `UHUDLobbyManager`, which creates it. On construct it fills its lists once with `UpdatePlayerLists`. After that it keeps itself current from the `AMPGS` lobby roster events.
 // 5. The button click events (`OnHumanJoinButtonClicked`, etc.) are bound in C++. They call functions on the `AMPControllerPlayer` to send requests to the server (e.g., to switch teams or add a bot).
 //
 // Necessary things to define:
@@ -20,8 +20,8 @@
 // How it interacts with other classes:
 // - UMPHUD: The base HUD class.
 // - UHUDLobbyManager: The parent/manager widget that controls this one.
-// - UHUDLobbyEntry: This widget dynamically creates instances of the lobby entry widget for each player in the game and adds them to its `ScrollBox` elements.
-// - AMPPlayerState: The `UpdatePlayerLists` function gets the `PlayerArray` from the Game State, iterates through all the `AMPPlayerState` objects, and uses their data (name, team, ready status) to create and populate the `UHUDLobbyEntry` widgets.
+// - UHUDLobbyEntry: This widget keeps one lobby entry widget per player and per bot, keyed by the roster `lobbyId`. `UpdatePlayerLists` diffs the whole roster against the kept entries. `HandleLobbyEvent` patches just the entry an event names, so one player toggling ready touches one entry. New players get an entry from `lobbyEntryPool` before a new widget is created, and entries of players who left go back to the pool. The scroll boxes are only refilled when someone joins, leaves, switches team or the order changes.
+// - AMPGS: Holds the replicated `lobbyRoster`, which is written by `UManagerLobby::SyncLobbyRoster` on the server. This widget binds to `OnLobbyEvent` in `NativeConstruct`. A joined player or added bot gets an entry inserted in place, and a leaving one has its entry released. A team switch moves the entry to the other list, and a ready toggle updates the entry. This works the same on the host and on clients, so nothing here reads the Game Mode.
 // - AMPControllerPlayer: Button clicks on this UI result in calls to the Player Controller to send `ServerRequest...` RPCs to the server.
 
 #include "MPHUD.h"
@@ -31,6 +31,9 @@ class UScrollBox;
 class UButton;
 class UTextBlock;
 class UHUDLobbyEntry;
+class AMPControllerPlayer;
+class AMPAIController;
+struct FMPLobbyEntry;
 
 UCLASS()
 class MEOWPHONE_API UHUDLobby : public UMPHUD
@@ -113,6 +116,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Player Lists")
 	TArray<UHUDLobbyEntry*> catPlayersList;
 
+	// entries no longer shown, handed out again before a new widget is created
+	UPROPERTY()
+	TArray<UHUDLobbyEntry*> lobbyEntryPool;
+
 public:
 	// Update player lists
 	UFUNCTION(BlueprintCallable, Category = "Lobby Management")
@@ -155,7 +162,24 @@ protected:
 	void OnRemoveBotClicked(int32 playerIndex);
 
 
-	// Create lobby entry widget
+	// Patch the one entry a lobby roster event is about
+	void HandleLobbyEvent(ELobbyEvent lobbyEvent, const FMPLobbyEntry& rosterEntry);
+
+	// Reuse the entry of each row found in unusedEntries, create the rest; refill the scroll box only if the order changed
+	void SyncTeamList(const TArray<const FMPLobbyEntry*>& rows, TArray<UHUDLobbyEntry*>& teamList, UScrollBox* scrollBox, 
+		TMap<int32, UHUDLobbyEntry*>& unusedEntries, int32& outUpdatedEntries);
+	bool ApplyRosterEntry(UHUDLobbyEntry* entry, const FMPLobbyEntry& rosterEntry);
+	UHUDLobbyEntry* CreateRosterEntry(const FMPLobbyEntry& rosterEntry);
+
+	UHUDLobbyEntry* FindLobbyEntry(int32 lobbyId) const;
+	bool GetTeamList(ETeam team, TArray<UHUDLobbyEntry*>*& outTeamList, UScrollBox*& outScrollBox);
+	// Players before bots, each in join order
+	static bool IsListedBefore(bool isBotA, int32 lobbyIdA, bool isBotB, int32 lobbyIdB);
+	void InsertIntoTeamList(UHUDLobbyEntry* entry);
+	void RemoveFromTeamList(UHUDLobbyEntry* entry);
+	void ReleaseLobbyEntry(UHUDLobbyEntry* entry);
+
+	// Create lobby entry widget, from the pool when it has one
 	UFUNCTION(BlueprintCallable, Category = "Lobby Management")
 	UHUDLobbyEntry* CreateLobbyEntry(const FString& playerName, bool isBot, bool isLobbyReady, 
 		ETeam team, int32 playerIndex, class AMPControllerPlayer* playerController, 
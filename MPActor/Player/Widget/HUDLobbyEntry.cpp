@@ -61,8 +61,41 @@ void UHUDLobbyEntry::InitializeEntry(const FString& inPlayerName, bool inIsBot,
 	// Update UI
 	UpdateUI();
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Lobby entry initialized: %s (Bot: %s, Ready: %s, Team: %d)"), 
-		*playerName, isBot ? TEXT("Yes") : TEXT("No"), isReady ? TEXT("Yes") : TEXT("No"), (int32)playerTeam), TEXT("HUDLobbyEntry"));
+	MP_LOG_DEBUG(TEXT("HUDLobbyEntry"), TEXT("Lobby entry initialized: %s (Bot: %s, Ready: %s, Team: %d)"), 
+		*playerName, isBot ? TEXT("Yes") : TEXT("No"), isReady ? TEXT("Yes") : TEXT("No"), (int32)playerTeam);
+}
+
+bool UHUDLobbyEntry::ApplyEntryData(const FString& inPlayerName, bool inIsBot, bool inIsReady, 
+	ETeam inPlayerTeam, int32 inPlayerIndex, AMPControllerPlayer* inPlayerController, 
+	AMPAIController* inAIController)
+{
+	bool hasChanged = false;
+
+	if (playerName != inPlayerName)
+	{
+		UpdatePlayerName(inPlayerName);
+		hasChanged = true;
+	}
+
+	if (isReady != inIsReady)
+	{
+		UpdateReadyStatus(inIsReady);
+		hasChanged = true;
+	}
+
+	// no widget shows these, they only need to be current for the remove button and the team list
+	if (isBot != inIsBot || playerTeam != inPlayerTeam || playerIndex != inPlayerIndex || 
+		playerController != inPlayerController || aiController != inAIController)
+	{
+		isBot = inIsBot;
+		playerTeam = inPlayerTeam;
+		playerIndex = inPlayerIndex;
+		playerController = inPlayerController;
+		aiController = inAIController;
+		hasChanged = true;
+	}
+
+	return hasChanged;
 }
 
 void UHUDLobbyEntry::UpdateReadyStatus(bool inIsReady)
@@ -86,8 +119,8 @@ void UHUDLobbyEntry::UpdateReadyStatus(bool inIsReady)
 		}
 	}
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Ready status updated: %s (Ready: %s)"), 
-		*playerName, isReady ? TEXT("Yes") : TEXT("No")), TEXT("HUDLobbyEntry"));
+	MP_LOG_DEBUG(TEXT("HUDLobbyEntry"), TEXT("Ready status updated: %s (Ready: %s)"), 
+		*playerName, isReady ? TEXT("Yes") : TEXT("No"));
 }
 
 void UHUDLobbyEntry::UpdatePlayerName(const FString& inPlayerName)
@@ -99,7 +132,7 @@ void UHUDLobbyEntry::UpdatePlayerName(const FString& inPlayerName)
 		playerNameText->SetText(FText::FromString(playerName));
 	}
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Player name updated: %s"), *playerName), TEXT("HUDLobbyEntry"));
+	MP_LOG_DEBUG(TEXT("HUDLobbyEntry"), TEXT("Player name updated: %s"), *playerName);
 }
 
 void UHUDLobbyEntry::UpdateHostVisibility(bool isHost)
@@ -111,24 +144,24 @@ void UHUDLobbyEntry::UpdateHostVisibility(bool isHost)
 		removeButton->SetVisibility(shouldShow ? ESlateVisibility::Visible : ESlateVisibility::Hidden);
 	}
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Host visibility updated: %s (Host: %s, Bot: %s)"), 
-		*playerName, isHost ? TEXT("Yes") : TEXT("No"), isBot ? TEXT("Yes") : TEXT("No")), TEXT("HUDLobbyEntry"));
+	MP_LOG_DEBUG(TEXT("HUDLobbyEntry"), TEXT("Host visibility updated: %s (Host: %s, Bot: %s)"), 
+		*playerName, isHost ? TEXT("Yes") : TEXT("No"), isBot ? TEXT("Yes") : TEXT("No"));
 }
 
 void UHUDLobbyEntry::OnRemoveButtonClicked()
 {
 	if (isBot && playerIndex >= 0)
 	{
-		UManagerLog::LogInfo(FString::Printf(TEXT("Remove button clicked for bot: %s (Index: %d)"), 
-			*playerName, playerIndex), TEXT("HUDLobbyEntry"));
+		MP_LOG_INFO(TEXT("HUDLobbyEntry"), TEXT("Remove button clicked for bot: %s (Index: %d)"), 
+			*playerName, playerIndex);
 		
 		// Broadcast the remove bot event
 		OnRemoveBotClicked.Broadcast(playerIndex);
 	}
 	else
 	{
-		UManagerLog::LogWarning(FString::Printf(TEXT("Remove button clicked but not a bot: %s (Bot: %s, Index: %d)"), 
-			*playerName, isBot ? TEXT("Yes") : TEXT("No"), playerIndex), TEXT("HUDLobbyEntry"));
+		MP_LOG_WARNING(TEXT("HUDLobbyEntry"), TEXT("Remove button clicked but not a bot: %s (Bot: %s, Index: %d)"), 
+			*playerName, isBot ? TEXT("Yes") : TEXT("No"), playerIndex);
 	}
 }
 
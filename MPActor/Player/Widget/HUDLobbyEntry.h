@@ -18,7 +18,7 @@
 //
 // How it interacts with other classes:
 // - UUserWidget: The base class.
-// - UHUDLobby: The parent widget that creates, populates, and manages instances of this widget. It also listens to the `OnRemoveBotClicked` delegate.
+// - UHUDLobby: The parent widget that creates, pools and manages instances of this widget. It keeps one entry per `AMPGS` lobby roster entry, keyed by `lobbyId`, and calls `ApplyEntryData` on it when that roster entry changes. It also listens to the `OnRemoveBotClicked` delegate.
 // - Player Data: This widget is purely data-driven. It holds variables like `playerName` and `isReady` but does not fetch them itself; they are pushed into it by the parent `UHUDLobby` widget via the `InitializeEntry` function.
 
 #include "CoreMinimal.h"
@@ -74,6 +74,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Player Data")
 	AMPAIController* aiController;
 
+	// The lobby roster entry this widget shows, set by UHUDLobby
+	UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+	int32 lobbyId = INDEX_NONE;
+
 	// Localization keys
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Localization")
 	FString readyTextKey = TEXT("READY");
@@ -93,6 +97,12 @@ public:
 		ETeam inPlayerTeam, int32 inPlayerIndex, AMPControllerPlayer* inPlayerController, 
 		AMPAIController* inAIController);
 
+	// Re-point a kept or pooled entry at new data, only the widgets whose value changed are touched; returns whether anything changed
+	UFUNCTION(BlueprintCallable, Category = "Lobby Entry")
+	bool ApplyEntryData(const FString& inPlayerName, bool inIsBot, bool inIsReady, 
+		ETeam inPlayerTeam, int32 inPlayerIndex, AMPControllerPlayer* inPlayerController, 
+		AMPAIController* inAIController);
+
 	// Update ready status
 	UFUNCTION(BlueprintCallable, Category = "Lobby Entry")
 	void UpdateReadyStatus(bool inIsReady);
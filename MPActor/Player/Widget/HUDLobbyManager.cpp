@@ -188,7 +188,7 @@ void UHUDManagerLobby::InitializeManager()
 void UHUDManagerLobby::RefreshCurrentTeam()
 {
 	currentTeam = GetCurrentTeam();
-	UManagerLog::LogDebug(FString::Printf(TEXT("Current team refreshed: %d"), (int32)currentTeam), TEXT("HUDManagerLobby"));
+	MP_LOG_DEBUG(TEXT("HUDManagerLobby"), TEXT("Current team refreshed: %d"), (int32)currentTeam);
 }
 
 void UHUDManagerLobby::CreateHUDWidgets()
@@ -274,7 +274,7 @@ void UHUDManagerLobby::CreateHUDWidgets()
 
 void UHUDManagerLobby::ShowCustomizationHUD(ETeam team)
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Showing customization HUD for team: %d"), (int32)team), TEXT("HUDManagerLobby"));
+	MP_LOG_INFO(TEXT("HUDManagerLobby"), TEXT("Showing customization HUD for team: %d"), (int32)team);
 	
 	// Validate team value
 	if (team == ETeam::ENone)
@@ -325,7 +325,7 @@ void UHUDManagerLobby::ShowCustomizationHUD(ETeam team)
 		break;
 		
 	default:
-		UManagerLog::LogWarning(FString::Printf(TEXT("Invalid team for customization HUD: %d"), (int32)team), TEXT("HUDManagerLobby"));
+		MP_LOG_WARNING(TEXT("HUDManagerLobby"), TEXT("Invalid team for customization HUD: %d"), (int32)team);
 		break;
 	}
 }
@@ -352,8 +352,8 @@ void UHUDManagerLobby::UpdateReadyState(bool inIsReady)
 	isReady = inIsReady;
 	UpdateReadyButtonText();
 	
-	UManagerLog::LogDebug(FString::Printf(TEXT("Ready state updated: %s"), 
-		isReady ? TEXT("Ready") : TEXT("Not Ready")), TEXT("HUDManagerLobby"));
+	MP_LOG_DEBUG(TEXT("HUDManagerLobby"), TEXT("Ready state updated: %s"), 
+		isReady ? TEXT("Ready") : TEXT("Not Ready"));
 }
 
 void UHUDManagerLobby::UpdateReadyButtonText()
@@ -371,8 +371,8 @@ void UHUDManagerLobby::UpdateReadyButtonText()
 		
 		readyButtonText->SetText(readyText);
 		
-		UManagerLog::LogDebug(FString::Printf(TEXT("Ready button text updated: %s"), 
-			isReady ? TEXT("Ready") : TEXT("Not Ready")), TEXT("HUDManagerLobby"));
+		MP_LOG_DEBUG(TEXT("HUDManagerLobby"), TEXT("Ready button text updated: %s"), 
+			isReady ? TEXT("Ready") : TEXT("Not Ready"));
 	}
 }
 
@@ -389,7 +389,7 @@ void UHUDManagerLobby::UpdateCountdownText(int32 secondsRemaining)
 		FString countdownString = FString::Printf(TEXT("%d"), secondsRemaining);
 		countdownText->SetText(FText::FromString(countdownString));
 		
-		UManagerLog::LogDebug(FString::Printf(TEXT("Countdown updated: %d seconds"), secondsRemaining), TEXT("HUDManagerLobby"));
+		MP_LOG_DEBUG(TEXT("HUDManagerLobby"), TEXT("Countdown updated: %d seconds"), secondsRemaining);
 	}
 }
 
@@ -482,8 +482,8 @@ void UHUDManagerLobby::OnReadyButtonClicked()
 	if (owner)
 	{
 		bool newReadyState = !isReady;
-		UManagerLog::LogInfo(FString::Printf(TEXT("Setting ready state to: %s"), 
-			newReadyState ? TEXT("Ready") : TEXT("Not Ready")), TEXT("HUDManagerLobby"));
+		MP_LOG_INFO(TEXT("HUDManagerLobby"), TEXT("Setting ready state to: %s"), 
+			newReadyState ? TEXT("Ready") : TEXT("Not Ready"));
 		owner->SetReadyState(newReadyState);
 	}
 	else
@@ -526,7 +526,7 @@ void UHUDManagerLobby::UpdateUI()
 
 void UHUDManagerLobby::OnTeamChanged(ETeam newTeam)
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Team changed to: %d"), (int32)newTeam), TEXT("HUDManagerLobby"));
+	MP_LOG_INFO(TEXT("HUDManagerLobby"), TEXT("Team changed to: %d"), (int32)newTeam);
 	
 	// Validate team value
 	if (newTeam == ETeam::ENone)
@@ -59,6 +59,7 @@ void UHUDSearchSession::NativeDestruct()
 	
 	// Clear session list
 	ClearSessionList();
+	sessionEntryPool.Empty();
 	
 	Super::NativeDestruct();
 }
@@ -152,32 +153,67 @@ void UHUDSearchSession::UpdateSessionList()
 	}
 	
 	int32 sessionCount = gameInstance->GetSessionListCount();
-	UManagerLog::LogInfo(FString::Printf(TEXT("Updating session list with %d results"), sessionCount), TEXT("HUDSearchSession"));
+	MP_LOG_INFO(TEXT("HUDSearchSession"), TEXT("Updating session list with %d results"), sessionCount);
 	
-	// Clear existing list
-	ClearSessionList();
+	// Entries of the previous search are up for reuse, whatever is left afterwards goes back to the pool
+	TMap<FString, UHUDSearchSessionEntry*> unusedEntries;
+	unusedEntries.Reserve(sessionEntries.Num());
+	for (UHUDSearchSessionEntry* entry : sessionEntries)
+	{
+		if (entry) unusedEntries.Add(entry->GetEntryKey(), entry);
+	}
+	
+	TArray<UHUDSearchSessionEntry*> newEntries;
+	newEntries.Reserve(sessionCount);
+	int32 updatedEntries = 0;
 	
-	// Create entries for each session
 	for (int32 i = 0; i < sessionCount; ++i)
 	{
 		FSessionInfo sessionInfo = gameInstance->GetSessionInfo(i);
-		UHUDSearchSessionEntry* entry = CreateSessionEntry(sessionInfo, i);
+		
+		UHUDSearchSessionEntry* entry = nullptr;
+		if (unusedEntries.RemoveAndCopyValue(UHUDSearchSessionEntry::MakeEntryKey(sessionInfo.sessionName, sessionInfo.hostName), entry) && entry)
+		{
+			// Same session as before, only what changed is pushed to the widget
+			if (entry->ApplyEntryData(sessionInfo.curPlayersNum, sessionInfo.maxPlayersNum, sessionInfo.ping, IsSessionAvailableToJoin(sessionInfo), i))
+			{
+				updatedEntries++;
+			}
+		}
+		else
+		{
+			entry = CreateSessionEntry(sessionInfo, i);
+			updatedEntries++;
+		}
 		
 		if (entry)
 		{
-			sessionEntries.Add(entry);
-			
-			// Add to scroll box
-			if (sessionListScrollBox)
+			newEntries.Add(entry);
+		}
+	}
+	
+	for (const TPair<FString, UHUDSearchSessionEntry*>& unusedEntry : unusedEntries)
+	{
+		ReleaseSessionEntry(unusedEntry.Value);
+	}
+	
+	// The scroll box is only refilled when sessions appeared, disappeared or moved
+	if (newEntries != sessionEntries && sessionListScrollBox)
+	{
+		sessionListScrollBox->ClearChildren();
+		for (UHUDSearchSessionEntry* entry : newEntries)
+		{
+			UScrollBoxSlot* slot = Cast<UScrollBoxSlot>(sessionListScrollBox->AddChild(entry));
+			if (slot)
 			{
-				UScrollBoxSlot* slot = Cast<UScrollBoxSlot>(sessionListScrollBox->AddChild(entry));
-				if (slot)
-				{
-					slot->SetPadding(FMargin(5.0f, 2.0f, 5.0f, 2.0f));
-				}
+				slot->SetPadding(FMargin(5.0f, 2.0f, 5.0f, 2.0f));
 			}
 		}
 	}
+	sessionEntries = MoveTemp(newEntries);
+	
+	MP_LOG_DEBUG(TEXT("HUDSearchSession"), TEXT("Session list synced - Entries: %d, Changed entries: %d, Removed entries: %d"), 
+		sessionEntries.Num(), updatedEntries, unusedEntries.Num());
 	
 	// Stop searching
 	StopSessionSearch();
@@ -188,6 +224,12 @@ void UHUDSearchSession::UpdateSessionList()
 
 void UHUDSearchSession::ClearSessionList()
 {
+	// Entries go back to the pool, the next search reuses them
+	for (UHUDSearchSessionEntry* entry : sessionEntries)
+	{
+		ReleaseSessionEntry(entry);
+	}
+	
 	// Remove all entries from scroll box
 	if (sessionListScrollBox)
 	{
@@ -204,18 +246,18 @@ void UHUDSearchSession::JoinSession(int32 sessionIndex)
 {
 	if (sessionIndex < 0 || sessionIndex >= sessionEntries.Num())
 	{
-		UManagerLog::LogError(FString::Printf(TEXT("Invalid session index: %d"), sessionIndex), TEXT("HUDSearchSession"));
+		MP_LOG_ERROR(TEXT("HUDSearchSession"), TEXT("Invalid session index: %d"), sessionIndex);
 		return;
 	}
 	
 	UHUDSearchSessionEntry* entry = sessionEntries[sessionIndex];
 	if (!entry || !entry->availableToJoin)
 	{
-		UManagerLog::LogWarning(FString::Printf(TEXT("Cannot join session at index %d - not available"), sessionIndex), TEXT("HUDSearchSession"));
+		MP_LOG_WARNING(TEXT("HUDSearchSession"), TEXT("Cannot join session at index %d - not available"), sessionIndex);
 		return;
 	}
 	
-	UManagerLog::LogInfo(FString::Printf(TEXT("Joining session: %s (Index: %d)"), *entry->sessionName, sessionIndex), TEXT("HUDSearchSession"));
+	MP_LOG_INFO(TEXT("HUDSearchSession"), TEXT("Joining session: %s (Index: %d)"), *entry->sessionName, sessionIndex);
 	
 	// Get game instance and join session
 	UMPGI* gameInstance = Cast<UMPGI>(GetWorld()->GetGameInstance());
@@ -256,7 +298,7 @@ void UHUDSearchSession::OnRefreshButtonClicked()
 
 void UHUDSearchSession::OnSessionEntryJoinClicked(int32 sessionIndex)
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Session entry join clicked for index: %d"), sessionIndex), TEXT("HUDSearchSession"));
+	MP_LOG_INFO(TEXT("HUDSearchSession"), TEXT("Session entry join clicked for index: %d"), sessionIndex);
 	
 	// Join the session
 	JoinSession(sessionIndex);
@@ -264,7 +306,7 @@ void UHUDSearchSession::OnSessionEntryJoinClicked(int32 sessionIndex)
 
 void UHUDSearchSession::OnSearchCompleted(bool searchCompleted)
 {
-	UManagerLog::LogInfo(FString::Printf(TEXT("Search completed with result: %s"), searchCompleted ? TEXT("Success") : TEXT("Failed")), TEXT("HUDSearchSession"));
+	MP_LOG_INFO(TEXT("HUDSearchSession"), TEXT("Search completed with result: %s"), searchCompleted ? TEXT("Success") : TEXT("Failed"));
 	
 	if (searchCompleted)
 	{
@@ -300,8 +342,8 @@ void UHUDSearchSession::UpdateSearchUI()
 		refreshButton->SetIsEnabled(!isSearching);
 	}
 	
-	UManagerLog::LogDebug(FString::Printf(TEXT("Search UI updated - Searching: %s, Entries: %d"), 
-		isSearching ? TEXT("Yes") : TEXT("No"), sessionEntries.Num()), TEXT("HUDSearchSession"));
+	MP_LOG_DEBUG(TEXT("HUDSearchSession"), TEXT("Search UI updated - Searching: %s, Entries: %d"), 
+		isSearching ? TEXT("Yes") : TEXT("No"), sessionEntries.Num());
 }
 
 UHUDSearchSessionEntry* UHUDSearchSession::CreateSessionEntry(const FSessionInfo& sessionInfo, int32 index)
@@ -312,12 +354,24 @@ UHUDSearchSessionEntry* UHUDSearchSession::CreateSessionEntry(const FSessionInfo
 		return nullptr;
 	}
 	
-	// Create the entry widget
-	UHUDSearchSessionEntry* entry = CreateWidget<UHUDSearchSessionEntry>(this, sessionEntryClass);
+	// Take a pooled entry first, a new widget is only created when the pool is empty
+	UHUDSearchSessionEntry* entry = nullptr;
+	while (!entry && sessionEntryPool.Num() > 0)
+	{
+		entry = sessionEntryPool.Pop(false);
+	}
+	
 	if (!entry)
 	{
-		UManagerLog::LogError(TEXT("Failed to create session entry widget"), TEXT("HUDSearchSession"));
-		return nullptr;
+		entry = CreateWidget<UHUDSearchSessionEntry>(this, sessionEntryClass);
+		if (!entry)
+		{
+			UManagerLog::LogError(TEXT("Failed to create session entry widget"), TEXT("HUDSearchSession"));
+			return nullptr;
+		}
+		
+		// Bind join event, a pooled entry keeps its binding
+		entry->OnJoinSessionClicked.AddDynamic(this, &UHUDSearchSession::OnSessionEntryJoinClicked);
 	}
 	
 	// Extract session information from FSessionInfo
@@ -331,14 +385,19 @@ UHUDSearchSessionEntry* UHUDSearchSession::CreateSessionEntry(const FSessionInfo
 	// Initialize the entry
 	entry->InitializeEntry(sessionName, hostName, currentPlayers, maxPlayers, ping, availableToJoin, index);
 	
-	// Bind join event
-	entry->OnJoinSessionClicked.AddDynamic(this, &UHUDSearchSession::OnSessionEntryJoinClicked);
-	
-	UManagerLog::LogDebug(FString::Printf(TEXT("Created session entry: %s (Index: %d)"), *sessionName, index), TEXT("HUDSearchSession"));
+	MP_LOG_DEBUG(TEXT("HUDSearchSession"), TEXT("Set up session entry: %s (Index: %d)"), *sessionName, index);
 	
 	return entry;
 }
 
+void UHUDSearchSession::ReleaseSessionEntry(UHUDSearchSessionEntry* entry)
+{
+	if (!entry) return;
+	
+	entry->RemoveFromParent();
+	sessionEntryPool.Add(entry);
+}
+
 bool UHUDSearchSession::IsSessionAvailableToJoin(const FSessionInfo& sessionInfo)
 {
 	// Check if session is not full
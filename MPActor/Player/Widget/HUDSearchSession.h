@@ -11,7 +11,7 @@
 // 3. In the Blueprint's defaults, you MUST set the `Session Entry Class`. This requires you to first create a separate widget for a single server row (inheriting from `UHUDSearchSessionEntry`) and then assign that Blueprint class here.
 // 4. When this widget is shown, its `NativeConstruct` calls `StartSessionSearch`. This function gets the `UMPGI` (Game Instance) and tells it to begin searching for online sessions.
 // 5. The Game Instance performs the search asynchronously. When the search is complete, the `UMPGI` calls the `OnSearchCompleted` function on this widget.
-// 6. `OnSearchCompleted` then calls `UpdateSessionList`, which gets the search results from the Game Instance. It iterates through the results, creates an instance of your `sessionEntryClass` for each one, populates it with the session data, and adds it to the `sessionListScrollBox`.
+// 6. `OnSearchCompleted` then calls `UpdateSessionList`, which gets the search results from the Game Instance. A session already listed by the previous search (same host and session name) keeps its entry, and only its changed fields (players, ping, availability) are updated. New sessions get an entry from `sessionEntryPool`, or a new instance of your `sessionEntryClass` when the pool is empty. Entries of sessions that disappeared go back to the pool. The `sessionListScrollBox` is only refilled when the set or order of sessions changed.
 //
 // Necessary things to define:
 // - All `BindWidget` properties must have corresponding widgets in the child Blueprint.
@@ -20,7 +20,7 @@
 // How it interacts with other classes:
 // - UMPHUD: The base HUD class.
 // - UMPGI (Game Instance): This widget's primary interaction is with the Game Instance. It tells the GI to `SearchForSessions`, and the GI calls `OnSearchCompleted` back on this widget when the async search finishes. It also gets the results from the GI and tells the GI which session to `JoinSessions`.
-// - UHUDSearchSessionEntry: This widget dynamically creates and populates instances of the session entry widget to build its server list.
+// - UHUDSearchSessionEntry: This widget keeps, pools and populates instances of the session entry widget to build its server list.
 // - UScrollBox: The UMG widget used to hold the list of server entries.
 
 #include "CoreMinimal.h"
@@ -92,10 +92,14 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Search State")
 	bool isSearching;
 
-	// Session entries
+	// Session entries, in the Game Instance's result order so an entry's position is its session index
 	UPROPERTY(BlueprintReadOnly, Category = "Session List")
 	TArray<UHUDSearchSessionEntry*> sessionEntries;
 
+	// entries no longer shown, handed out again before a new widget is created
+	UPROPERTY()
+	TArray<UHUDSearchSessionEntry*> sessionEntryPool;
+
 public:
 	// Start session search
 	UFUNCTION(BlueprintCallable, Category = "Session Search")
@@ -129,7 +133,9 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Session Search")
 	void OnSessionEntryJoinClicked(int32 sessionIndex);
 
-	// Create session entry widget
+	void ReleaseSessionEntry(UHUDSearchSessionEntry* entry);
+
+	// Create session entry widget, from the pool when it has one
 	UFUNCTION(BlueprintCallable, Category = "Session Search")
 	UHUDSearchSessionEntry* CreateSessionEntry(const FSessionInfo& sessionInfo, int32 index);
 
@@ -82,8 +82,51 @@ void UHUDSearchSessionEntry::InitializeEntry(const FString& inSessionName, const
 	// Update button state
 	UpdateButtonState();
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Session entry initialized: %s (Host: %s, Players: %d/%d, Ping: %d, Available: %s)"), 
-		*sessionName, *hostName, currentPlayersNumber, maxPlayersNumber, ping, availableToJoin ? TEXT("Yes") : TEXT("No")), TEXT("HUDSearchSessionEntry"));
+	MP_LOG_DEBUG(TEXT("HUDSearchSessionEntry"), TEXT("Session entry initialized: %s (Host: %s, Players: %d/%d, Ping: %d, Available: %s)"), 
+		*sessionName, *hostName, currentPlayersNumber, maxPlayersNumber, ping, availableToJoin ? TEXT("Yes") : TEXT("No"));
+}
+
+bool UHUDSearchSessionEntry::ApplyEntryData(int32 inCurrentPlayersNumber, int32 inMaxPlayersNumber, int32 inPing, bool inAvailableToJoin, int32 inSessionIndex)
+{
+	bool hasChanged = false;
+
+	// the index only routes the join click, no widget shows it
+	sessionIndex = inSessionIndex;
+
+	if (maxPlayersNumber != inMaxPlayersNumber)
+	{
+		maxPlayersNumber = inMaxPlayersNumber;
+		if (maxPlayersNumberText)
+		{
+			maxPlayersNumberText->SetText(FText::FromString(FString::FromInt(maxPlayersNumber)));
+		}
+		hasChanged = true;
+	}
+
+	if (currentPlayersNumber != inCurrentPlayersNumber)
+	{
+		UpdatePlayerCount(inCurrentPlayersNumber);
+		hasChanged = true;
+	}
+
+	if (ping != inPing)
+	{
+		UpdatePing(inPing);
+		hasChanged = true;
+	}
+
+	if (availableToJoin != inAvailableToJoin)
+	{
+		UpdateAvailability(inAvailableToJoin);
+		hasChanged = true;
+	}
+
+	return hasChanged;
+}
+
+FString UHUDSearchSessionEntry::MakeEntryKey(const FString& inSessionName, const FString& inHostName)
+{
+	return inHostName + TEXT("|") + inSessionName;
 }
 
 void UHUDSearchSessionEntry::UpdateAvailability(bool inAvailableToJoin)
@@ -91,8 +134,8 @@ void UHUDSearchSessionEntry::UpdateAvailability(bool inAvailableToJoin)
 	availableToJoin = inAvailableToJoin;
 	UpdateButtonState();
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Session availability updated: %s (Available: %s)"), 
-		*sessionName, availableToJoin ? TEXT("Yes") : TEXT("No")), TEXT("HUDSearchSessionEntry"));
+	MP_LOG_DEBUG(TEXT("HUDSearchSessionEntry"), TEXT("Session availability updated: %s (Available: %s)"), 
+		*sessionName, availableToJoin ? TEXT("Yes") : TEXT("No"));
 }
 
 void UHUDSearchSessionEntry::UpdatePing(int32 inPing)
@@ -104,8 +147,8 @@ void UHUDSearchSessionEntry::UpdatePing(int32 inPing)
 		pingText->SetText(FText::FromString(FString::FromInt(ping)));
 	}
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Session ping updated: %s (Ping: %d)"), 
-		*sessionName, ping), TEXT("HUDSearchSessionEntry"));
+	MP_LOG_DEBUG(TEXT("HUDSearchSessionEntry"), TEXT("Session ping updated: %s (Ping: %d)"), 
+		*sessionName, ping);
 }
 
 void UHUDSearchSessionEntry::UpdatePlayerCount(int32 inCurrentPlayersNumber)
@@ -117,24 +160,24 @@ void UHUDSearchSessionEntry::UpdatePlayerCount(int32 inCurrentPlayersNumber)
 		currentPlayersNumberText->SetText(FText::FromString(FString::FromInt(currentPlayersNumber)));
 	}
 
-	UManagerLog::LogDebug(FString::Printf(TEXT("Session player count updated: %s (Players: %d/%d)"), 
-		*sessionName, currentPlayersNumber, maxPlayersNumber), TEXT("HUDSearchSessionEntry"));
+	MP_LOG_DEBUG(TEXT("HUDSearchSessionEntry"), TEXT("Session player count updated: %s (Players: %d/%d)"), 
+		*sessionName, currentPlayersNumber, maxPlayersNumber);
 }
 
 void UHUDSearchSessionEntry::OnJoinButtonClicked()
 {
 	if (availableToJoin && sessionIndex >= 0)
 	{
-		UManagerLog::LogInfo(FString::Printf(TEXT("Join button clicked for session: %s (Index: %d)"), 
-			*sessionName, sessionIndex), TEXT("HUDSearchSessionEntry"));
+		MP_LOG_INFO(TEXT("HUDSearchSessionEntry"), TEXT("Join button clicked for session: %s (Index: %d)"), 
+			*sessionName, sessionIndex);
 		
 		// Broadcast the join session event
 		OnJoinSessionClicked.Broadcast(sessionIndex);
 	}
 	else
 	{
-		UManagerLog::LogWarning(FString::Printf(TEXT("Join button clicked but session not available: %s (Available: %s, Index: %d)"), 
-			*sessionName, availableToJoin ? TEXT("Yes") : TEXT("No"), sessionIndex), TEXT("HUDSearchSessionEntry"));
+		MP_LOG_WARNING(TEXT("HUDSearchSessionEntry"), TEXT("Join button clicked but session not available: %s (Available: %s, Index: %d)"), 
+			*sessionName, availableToJoin ? TEXT("Yes") : TEXT("No"), sessionIndex);
 	}
 }
 
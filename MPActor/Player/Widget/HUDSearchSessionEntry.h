@@ -18,7 +18,7 @@
 //
 // How it interacts with other classes:
 // - UUserWidget: The base class.
-// - UHUDSearchSession: The parent widget that creates, populates, and manages instances of this widget. It listens to the `OnJoinSessionClicked` delegate to know when the player wants to join this specific session.
+// - UHUDSearchSession: The parent widget that creates, pools and manages instances of this widget. A session found again by a later search keeps its entry and gets `ApplyEntryData`. It listens to the `OnJoinSessionClicked` delegate to know when the player wants to join this specific session.
 // - FSessionInfo (Struct): Although not directly referenced, the data used to populate this widget (via `InitializeEntry`) is originally sourced from this struct in the `UMPGI`.
 
 #include "CoreMinimal.h"
@@ -94,6 +94,14 @@ public:
 	void InitializeEntry(const FString& inSessionName, const FString& inHostName, 
 		int32 inCurrentPlayersNumber, int32 inMaxPlayersNumber, int32 inPing, bool inAvailableToJoin, int32 inSessionIndex);
 
+	// Re-point a kept or pooled entry at a fresh search result, only the widgets whose value changed are touched; returns whether anything changed
+	UFUNCTION(BlueprintCallable, Category = "Session Entry")
+	bool ApplyEntryData(int32 inCurrentPlayersNumber, int32 inMaxPlayersNumber, int32 inPing, bool inAvailableToJoin, int32 inSessionIndex);
+
+	// Sessions carry no id in FSessionInfo, host and session name together identify one across searches
+	static FString MakeEntryKey(const FString& inSessionName, const FString& inHostName);
+	FString GetEntryKey() const { return MakeEntryKey(sessionName, hostName); }
+
 	// Update availability
 	UFUNCTION(BlueprintCallable, Category = "Session Entry")
 	void UpdateAvailability(bool inAvailableToJoin);
@@ -22,6 +22,8 @@ using UnrealBuildTool;
 //
 // PrivateDependencyModuleNames:
 // - Slate, SlateCore: Lower-level UI frameworks that UMG is built upon. Needed for some advanced UI customization.
+// - ReplicationGraph: For `UMPReplicationGraph`, the spatial / owner-only routing of replicated actors. The ReplicationGraph plugin must be enabled in the .uproject.
+// - NetCore: For push-model replication (`MARK_PROPERTY_DIRTY_FROM_NAME`). Push model must also be enabled in DefaultEngine.ini: `[SystemSettings] net.IsPushModelEnabled=1`.
 
 public class MeowPhone : ModuleRules
 {
@@ -39,7 +41,9 @@ public class MeowPhone : ModuleRules
 
         PrivateDependencyModuleNames.AddRange(new string[] {
             "Slate",
-            "SlateCore"
+            "SlateCore",
+            "NetCore",
+            "ReplicationGraph"
         });
     }
 }
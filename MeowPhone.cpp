@@ -3,4 +3,13 @@
 #include "MeowPhone.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, MeowPhone, "MeowPhone" );
+#include "HighLevel/MPReplicationGraph.h"
+
+void FMeowPhoneModule::StartupModule()
+{
+	FDefaultGameModuleImpl::StartupModule();
+
+	UMPReplicationGraph::RegisterReplicationDriver();
+}
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FMeowPhoneModule, MeowPhone, "MeowPhone" );
@@ -8,6 +8,15 @@
 // It is typically included by source files within this module and serves as a
 // precompiled header entry point if configured. It primarily includes CoreMinimal.h
 // to provide access to core Unreal Engine types.
+// The module itself only adds one startup step: installing `UMPReplicationGraph` for the game net driver.
 
 #include "CoreMinimal.h"
+#include "Modules/ModuleInterface.h"
+#include "Modules/ModuleManager.h"
+
+class FMeowPhoneModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override;
+};
 